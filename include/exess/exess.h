@@ -1,4 +1,4 @@
-// Copyright 2021-2025 David Robillard <d@drobilla.net>
+// Copyright 2021-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_EXESS_H
@@ -858,6 +858,17 @@ typedef struct {
   uint32_t      nanosecond; ///< Nanosecond: [0, 999999999]
 } ExessDateTime;
 
+/**
+   A point in time relative to the epoch, 1970-01-01T00:00:00Z.
+
+   Unlike #ExessDateTime, this is a linear count, so instants can be compared
+   or subtracted with simple integer arithmetic.
+*/
+typedef struct {
+  int64_t  seconds;     ///< Whole seconds since the epoch
+  uint32_t nanoseconds; ///< Nanoseconds after `seconds`: [0, 999999999]
+} ExessEpochTime;
+
 /**
    Compare two dateTimes.
 
@@ -900,6 +911,38 @@ exess_add_date_time_duration(ExessDateTime s, ExessDuration d);
 EXESS_CONST_API ExessDateTime
 exess_date_time_to_utc(ExessDateTime datetime);
 
+/**
+   Convert a dateTime to a time since the epoch.
+
+   A local dateTime has no defined relation to UTC, so it is treated as if it
+   was in UTC.  The result is then the time since 1970-01-01T00:00:00 in
+   whatever the local timezone is, which is only meaningful in relation to
+   other local values.
+
+   @param datetime A valid dateTime.
+   @return The number of seconds and nanoseconds since the epoch.
+*/
+EXESS_CONST_API ExessEpochTime
+exess_date_time_to_epoch(ExessDateTime datetime);
+
+/**
+   Convert a time since the epoch to a dateTime.
+
+   This is the inverse of exess_date_time_to_epoch(), which returns a dateTime
+   that represents the given time in some timezone.  If `zone` is
+   #EXESS_LOCAL, then the epoch is taken to be in the local timezone, so the
+   fields are the same as they would be for #EXESS_UTC.
+
+   Nanoseconds past a whole second are carried into the seconds.
+
+   @param time The time since the epoch.
+   @param zone The timezone of the returned dateTime.
+   @return A dateTime in timezone `zone`, or an infinite past or infinite
+   future if the year is out of range (see exess_add_date_time_duration()).
+*/
+EXESS_CONST_API ExessDateTime
+exess_date_time_from_epoch(ExessEpochTime time, ExessTimezone zone);
+
 /**
    Read a dateTime string after any leading whitespace.
 
@@ -1100,6 +1143,29 @@ exess_write_time(ExessTime value, size_t buf_size, char* EXESS_NULLABLE buf);
 EXESS_CONST_API size_t
 exess_decoded_base64_size(size_t length);
 
+/**
+   Measure the binary value of a base64 string.
+
+   This scans the string exactly as exess_read_base64() would read it, but
+   without writing any output, to find the exact size of the decoded data.
+   This is slower than exess_decoded_base64_size(), but the result accounts
+   for whitespace and padding, so it can be used to allocate exactly the
+   required space.
+
+   This reads at most `len` characters, but also stops at a null character
+   if one is found earlier, so `len` may be `SIZE_MAX` to measure a
+   null-terminated string.
+
+   @param len The maximum number of characters to read.
+   @param str String to parse.
+
+   @return The `read_count` of characters read, `write_count` of bytes that
+   would be written, and a `status` code, which are the same as
+   exess_read_base64() would return given enough space.
+*/
+EXESS_PURE_API ExessVariableResult
+exess_measure_base64(size_t len, const char* EXESS_NONNULL str);
+
 /**
    Read a binary value from a base64 string.
 
@@ -1128,6 +1194,27 @@ exess_read_base64(size_t                    out_size,
                   void* EXESS_NONNULL       out,
                   const char* EXESS_NONNULL str);
 
+/**
+   Read a binary value from a base64 string in place.
+
+   This works like exess_read_base64(), but decodes the value over the string
+   itself, which is possible since decoded data is always smaller than its
+   encoding.  This avoids needing a separate output buffer, which can save a
+   lot of memory for large values.
+
+   Afterwards, the first `write_count` bytes of `str` contain the decoded
+   data, the following characters up to `read_count` may be clobbered, and
+   the rest of the string is unchanged.
+
+   @param len The maximum number of characters to read.
+   @param str String to parse, which will be overwritten.
+
+   @return The `read_count` of characters read, `write_count` of bytes written
+   to the start of `str`, and a `status` code.
+*/
+EXESS_API ExessVariableResult
+exess_read_base64_in_place(size_t len, char* EXESS_NONNULL str);
+
 /**
    Write a canonical `base64Binary` string.
 
@@ -1149,6 +1236,115 @@ exess_write_base64(size_t                    data_size,
                    size_t                    buf_size,
                    char* EXESS_NULLABLE      buf);
 
+/**
+   State for decoding base64 incrementally.
+
+   This can be used to decode a string that isn't entirely in memory, like
+   one that is read from a file or socket in chunks.  Groups of characters may
+   be split across chunks, and whitespace is skipped anywhere as usual.
+*/
+typedef struct {
+  uint8_t chars[4]; ///< Characters of the current group
+  uint8_t n_chars;  ///< Number of characters in the current group
+} ExessBase64Decoder;
+
+/// Initialize a base64 decoder to start reading a new value
+EXESS_API void
+exess_base64_decoder_init(ExessBase64Decoder* EXESS_NONNULL decoder);
+
+/**
+   Decode a chunk of base64.
+
+   This decodes as much of `chunk` as possible, writing any complete bytes to
+   `out`.  Characters of an incomplete group are saved in the decoder, so the
+   next chunk continues where this one left off.
+
+   If there isn't enough space in `out` for a group, then #EXESS_NO_SPACE is
+   returned and the remainder of the chunk, starting at `read_count`, can be
+   fed again with more space.  Any other error is final.
+
+   @param decoder Decoder state.
+   @param len The length of `chunk` in bytes.
+   @param chunk Base64 characters to decode, which needn't be null-terminated.
+   @param out_size The size of `out` in bytes.
+   @param out Buffer where decoded bytes will be written.
+
+   @return The `read_count` of characters read from `chunk`, `write_count` of
+   bytes written to `out`, and a `status` code.
+*/
+EXESS_API ExessVariableResult
+exess_base64_decoder_feed(ExessBase64Decoder* EXESS_NONNULL decoder,
+                          size_t                            len,
+                          const char* EXESS_NONNULL         chunk,
+                          size_t                            out_size,
+                          void* EXESS_NONNULL               out);
+
+/**
+   Finish decoding base64.
+
+   @return #EXESS_SUCCESS, or #EXESS_EXPECTED_BASE64 if the input ended in the
+   middle of a group.
+*/
+EXESS_PURE_API ExessStatus
+exess_base64_decoder_finish(const ExessBase64Decoder* EXESS_NONNULL decoder);
+
+/**
+   State for encoding base64 incrementally.
+
+   This can be used to write base64 for data that isn't entirely in memory,
+   with output in chunks of limited size.
+*/
+typedef struct {
+  uint8_t bytes[3]; ///< Bytes of the current group
+  uint8_t n_bytes;  ///< Number of bytes in the current group
+} ExessBase64Encoder;
+
+/// Initialize a base64 encoder to start writing a new value
+EXESS_API void
+exess_base64_encoder_init(ExessBase64Encoder* EXESS_NONNULL encoder);
+
+/**
+   Encode a chunk of data to base64.
+
+   This writes as many complete groups of 4 characters as fit in `buf`.  Up
+   to 2 bytes at the end of the data are saved in the encoder until the next
+   chunk, or until the encoder is finished.  The output isn't null-terminated.
+
+   @param encoder Encoder state.
+   @param data_size The size of `data` in bytes.
+   @param data Data to encode.
+   @param buf_size The size of `buf` in bytes.
+   @param buf Output buffer.
+
+   @return The `read_count` of bytes read from `data`, `write_count` of
+   characters written to `buf`, and `status` #EXESS_SUCCESS, or
+   #EXESS_NO_SPACE if `buf` is too small to encode all of the data.
+*/
+EXESS_API ExessVariableResult
+exess_base64_encoder_feed(ExessBase64Encoder* EXESS_NONNULL encoder,
+                          size_t                            data_size,
+                          const void* EXESS_NONNULL         data,
+                          size_t                            buf_size,
+                          char* EXESS_NONNULL               buf);
+
+/**
+   Finish encoding base64.
+
+   This writes the last group of characters with any necessary padding, which
+   is at most 4 characters.  The output isn't null-terminated.
+
+   @param encoder Encoder state.
+   @param buf_size The size of `buf` in bytes.
+   @param buf Output buffer.
+
+   @return The `count` of characters written, and `status` #EXESS_SUCCESS, or
+   #EXESS_NO_SPACE if `buf` is too small.
+*/
+EXESS_API ExessResult
+exess_base64_encoder_finish(ExessBase64Encoder* EXESS_NONNULL encoder,
+                            size_t                            buf_size,
+                            char* EXESS_NONNULL               buf);
+
 /**
    @}
    @defgroup exess_hex hexBinary
@@ -1202,6 +1398,27 @@ exess_read_hex(size_t                    out_size,
                void* EXESS_NONNULL       out,
                const char* EXESS_NONNULL str);
 
+/**
+   Read a binary value from a hex string in place.
+
+   This works like exess_read_hex(), but decodes the value over the string
+   itself, which is possible since decoded data is always smaller than its
+   encoding.  This avoids needing a separate output buffer, which can save a
+   lot of memory for large values.
+
+   Afterwards, the first `write_count` bytes of `str` contain the decoded
+   data, the following characters up to `read_count` may be clobbered, and
+   the rest of the string is unchanged.
+
+   @param len The maximum number of characters to read.
+   @param str String to parse, which will be overwritten.
+
+   @return The `read_count` of characters read, `write_count` of bytes written
+   to the start of `str`, and a `status` code.
+*/
+EXESS_API ExessVariableResult
+exess_read_hex_in_place(size_t len, char* EXESS_NONNULL str);
+
 /**
    Write a canonical `hexBinary` string.
 
@@ -1222,6 +1439,56 @@ exess_write_hex(size_t                    data_size,
                 size_t                    buf_size,
                 char* EXESS_NULLABLE      buf);
 
+/**
+   State for decoding hex incrementally.
+
+   This can be used to decode a string that isn't entirely in memory, like
+   one that is read from a file or socket in chunks.  The two digits of a
+   byte may be split across chunks.  Unlike exess_read_hex(), whitespace is
+   skipped between any bytes, so line-wrapped input can be decoded.
+
+   Since hex encoding needs no state, data can be encoded in chunks by simply
+   calling exess_write_hex() for each.
+*/
+typedef struct {
+  uint8_t high;     ///< Value of the first digit of the current byte
+  bool    has_high; ///< True if the first digit has been read
+} ExessHexDecoder;
+
+/// Initialize a hex decoder to start reading a new value
+EXESS_API void
+exess_hex_decoder_init(ExessHexDecoder* EXESS_NONNULL decoder);
+
+/**
+   Decode a chunk of hex.
+
+   This works like exess_base64_decoder_feed(), but for hex.
+
+   @param decoder Decoder state.
+   @param len The length of `chunk` in bytes.
+   @param chunk Hex characters to decode, which needn't be null-terminated.
+   @param out_size The size of `out` in bytes.
+   @param out Buffer where decoded bytes will be written.
+
+   @return The `read_count` of characters read from `chunk`, `write_count` of
+   bytes written to `out`, and a `status` code.
+*/
+EXESS_API ExessVariableResult
+exess_hex_decoder_feed(ExessHexDecoder* EXESS_NONNULL decoder,
+                       size_t                         len,
+                       const char* EXESS_NONNULL      chunk,
+                       size_t                         out_size,
+                       void* EXESS_NONNULL            out);
+
+/**
+   Finish decoding hex.
+
+   @return #EXESS_SUCCESS, or #EXESS_EXPECTED_HEX if the input ended in the
+   middle of a byte.
+*/
+EXESS_PURE_API ExessStatus
+exess_hex_decoder_finish(const ExessHexDecoder* EXESS_NONNULL decoder);
+
 /**
    @}
    @}
@@ -1412,6 +1679,93 @@ exess_compare_value(ExessDatatype             lhs_datatype,
                     size_t                    rhs_size,
                     const void* EXESS_NONNULL rhs_value);
 
+/**
+   The maximum size of a sort key for a fixed-size value in bytes.
+
+   Keys for #EXESS_HEX and #EXESS_BASE64 are as large as the value itself.
+*/
+#define EXESS_MAX_SORT_KEY_SIZE 36U
+
+/**
+   Write a binary sort key for a value.
+
+   The key is a string of bytes that sorts with `memcmp` in the same order as
+   exess_compare_value() sorts values of the same datatype.  Keys of different
+   datatypes are not comparable.  This is useful for storing values in an
+   index which only supports bytewise comparison.
+
+   Where the value order is partial, some choices are made to get a total
+   order that agrees with every definite comparison.  Negative zero sorts
+   equal to zero, and NaN sorts after everything else (including positive
+   infinity).  Local times sort as if they were in UTC, before any zoned time
+   at the same instant.  Durations sort by the dateTimes they reach from each
+   of the reference dateTimes used by exess_compare_duration() in turn, so
+   durations that are equal from every reference have equal keys.
+
+   @param datatype The datatype of the value.
+   @param value_size The size of `value` in bytes.
+   @param value Value to write the key for.
+   @param key_size The size of `key` in bytes.
+   @param key Buffer where the key will be written, or null to only measure.
+
+   @return The `count` of bytes in the key (even if `key` is null), and a
+   `status` code.
+*/
+EXESS_API ExessResult
+exess_write_sort_key(ExessDatatype             datatype,
+                     size_t                    value_size,
+                     const void* EXESS_NONNULL value,
+                     size_t                    key_size,
+                     void* EXESS_NULLABLE      key);
+
+/**
+   Return a hash of a value.
+
+   Values that exess_compare_value() considers equal have equal hashes, even
+   if they are represented differently.  For example, a zoned dateTime and the
+   equivalent time in UTC have the same hash, as do negative and positive
+   zero.  The exception is NaN, which is unordered so exess_compare_value()
+   considers it equal to any number, but it only has the same hash as other
+   NaNs.  Values of different datatypes are never equal, so the datatype is
+   also included in the hash.
+
+   This is much faster than writing a canonical string and hashing that, but
+   the hash isn't stable between versions of this library, so shouldn't be
+   stored.
+
+   @param datatype The datatype of the value.
+   @param value_size The size of `value` in bytes.
+   @param value Value to hash.
+*/
+EXESS_PURE_API uint64_t
+exess_hash_value(ExessDatatype             datatype,
+                 size_t                    value_size,
+                 const void* EXESS_NONNULL value);
+
+/**
+   Hash an array of values.
+
+   This sets each element of `hashes` to the exess_hash_value() of the
+   corresponding element of `values`, which is an array of values of the given
+   datatype.  Like exess_read_values(), only datatypes with a fixed value size
+   are supported, and the datatype is only checked once.
+
+   @param datatype The datatype of the values.
+   @param n_values The number of values to hash.
+   @param values_size The size of `values` in bytes.
+   @param values Array of `n_values` values to hash.
+   @param hashes Output array of `n_values` hashes.
+
+   @return #EXESS_SUCCESS, #EXESS_UNSUPPORTED if the datatype is not
+   supported, or #EXESS_BAD_VALUE if `values` is too small.
+*/
+EXESS_API ExessStatus
+exess_hash_values(ExessDatatype             datatype,
+                  size_t                    n_values,
+                  size_t                    values_size,
+                  const void* EXESS_NONNULL values,
+                  uint64_t* EXESS_NONNULL   hashes);
+
 /**
    Read any supported datatype from a string.
 
@@ -1433,6 +1787,73 @@ exess_read_value(ExessDatatype             datatype,
                  void* EXESS_NONNULL       out,
                  const char* EXESS_NONNULL str);
 
+/**
+   Read any supported datatype from a string with a length.
+
+   This is like exess_read_value(), but reads at most `len` characters, so
+   `str` doesn't need to be null-terminated.  This allows reading values
+   directly from a larger buffer, such as a mapped file, without copying.
+   Reading also stops at a null character, if one is found earlier.
+
+   @param datatype The datatype to read the string as.
+   @param out_size The size of `out` in bytes.
+   @param out Set to the parsed value on success.
+   @param len The maximum number of characters to read from `str`.
+   @param str String input.
+
+   @return The `read_count` from `str`, `write_count` to `out` (both in bytes),
+   and a `status` code.
+*/
+EXESS_API ExessVariableResult
+exess_read_value_n(ExessDatatype             datatype,
+                   size_t                    out_size,
+                   void* EXESS_NONNULL       out,
+                   size_t                    len,
+                   const char* EXESS_NONNULL str);
+
+/// A string that isn't necessarily null-terminated
+typedef struct {
+  const char* EXESS_NONNULL data;   ///< Pointer to the first character
+  size_t                    length; ///< Length of string in bytes
+} ExessStringView;
+
+/**
+   Read many strings of the same datatype into an array of values.
+
+   This reads each string like exess_read_value_n() into consecutive elements
+   of `out`, which is an array of values of the given datatype.  The datatype
+   is only checked once, so this is considerably faster than reading each
+   string separately.  Only datatypes with a fixed value size (not
+   #EXESS_HEX or #EXESS_BASE64) are supported.
+
+   Unlike the other read functions, every string must contain exactly one
+   value, optionally surrounded by whitespace.  Any other trailing characters
+   are an #EXESS_BAD_VALUE error for that value.
+
+   Note that `out` must be suitably aligned for the datatype being read, like
+   with exess_read_value().
+
+   @param datatype The datatype to read the strings as.
+   @param n_values The number of strings to read.
+   @param strings Array of `n_values` strings to read.
+   @param out_size The size of `out` in bytes.
+   @param out Output array of at least `n_values` values.
+   @param statuses Array of `n_values` statuses which is set to the status of
+   reading each value, or null.
+
+   @return #EXESS_SUCCESS if every value was read successfully, the status of
+   the first value that failed to read, #EXESS_UNSUPPORTED if the datatype is
+   not supported, or #EXESS_NO_SPACE if `out` is too small.  Nothing is read
+   if the datatype or space is invalid.
+*/
+EXESS_API ExessStatus
+exess_read_values(ExessDatatype                        datatype,
+                  size_t                               n_values,
+                  const ExessStringView* EXESS_NONNULL strings,
+                  size_t                               out_size,
+                  void* EXESS_NONNULL                  out,
+                  ExessStatus* EXESS_NULLABLE          statuses);
+
 /**
    Write any supported datatype to a canonical string.
 
@@ -1456,6 +1877,75 @@ exess_write_value(ExessDatatype             datatype,
                   size_t                    buf_size,
                   char* EXESS_NULLABLE      buf);
 
+/**
+   Function to grow the string heap used by exess_write_values().
+
+   This must return a heap that is at least `min_size` bytes, which starts
+   with the contents of the current `heap`, and set `heap_size` to its size.
+   For example, this can be implemented with `realloc()`, preferably with some
+   extra space so that the heap is rarely grown.
+
+   @param handle The `grow_handle` passed to exess_write_values().
+   @param min_size The minimum required size of the heap in bytes.
+   @param heap_size The current size of the heap in bytes, which must be set
+   to the new size on success.
+   @param heap The current heap, which may be null if the size is zero.
+
+   @return A pointer to the new heap, or null on failure, in which case the
+   current heap must be unchanged.
+*/
+typedef char* EXESS_NULLABLE (*ExessGrowFunc)(void* EXESS_NULLABLE  handle,
+                                              size_t                min_size,
+                                              size_t* EXESS_NONNULL heap_size,
+                                              char* EXESS_NULLABLE  heap);
+
+/**
+   Write an array of values to canonical strings in a contiguous heap.
+
+   This writes every value in `values`, which is an array of values of the
+   given datatype, to strings one after another in `heap`.  The strings aren't
+   separated, instead the string for value `i` starts at `offsets[i]`, and has
+   length `offsets[i + 1] - offsets[i]`.  The last offset, `offsets[n_values]`,
+   is the total length of all strings.  Like exess_read_values(), only
+   datatypes with a fixed value size are supported, and the datatype is only
+   checked once.
+
+   If a value is invalid, then nothing is written for it (so its string is
+   empty, which is never a valid value), and writing continues with the next.
+
+   If the heap runs out of space, then it's grown by calling `grow`, which
+   may move it.  The final heap and its size are always returned in `heap` and
+   `heap_size`, even on errors.  If the heap can't be grown, then writing stops
+   and only the offsets of the values before the one that didn't fit are set.
+
+   @param datatype The datatype of the values.
+   @param n_values The number of values to write.
+   @param values_size The size of `values` in bytes.
+   @param values Array of `n_values` values to write.
+   @param offsets Output array of `n_values + 1` string offsets.
+   @param heap_size The size of `heap` in bytes, set to the new size if the
+   heap is grown.
+   @param heap Pointer to the heap to write to, set to the new heap if it is
+   grown.
+   @param grow Function to grow the heap, or null to never grow it.
+   @param grow_handle Opaque pointer passed to `grow`.
+
+   @return #EXESS_SUCCESS if every value was written successfully, the status
+   of the first value that failed to write, #EXESS_UNSUPPORTED if the datatype
+   is not supported, #EXESS_BAD_VALUE if `values` is too small, or
+   #EXESS_NO_SPACE if the heap ran out of space and couldn't be grown.
+*/
+EXESS_API ExessStatus
+exess_write_values(ExessDatatype                       datatype,
+                   size_t                              n_values,
+                   size_t                              values_size,
+                   const void* EXESS_NONNULL           values,
+                   size_t* EXESS_NONNULL               offsets,
+                   size_t* EXESS_NONNULL               heap_size,
+                   char* EXESS_NULLABLE* EXESS_NONNULL heap,
+                   ExessGrowFunc EXESS_NULLABLE        grow,
+                   void* EXESS_NULLABLE                grow_handle);
+
 /**
    @}
    @defgroup exess_canon Canonical Form
@@ -1570,6 +2060,98 @@ exess_coerce_value(ExessCoercions            coercions,
 
 /**
    @}
+   @defgroup exess_parallel Parallel Processing
+
+   Reading and writing large arrays of values with several threads.
+
+   These split the input into chunks which are processed by a number of
+   threads, including the calling thread, which each take the next unprocessed
+   chunk until there are none left.  The output is exactly the same as the
+   equivalent single-threaded function.  If the library was built without
+   thread support, or only one thread is requested, then these simply call
+   the single-threaded function.
+
+   @{
+*/
+
+/**
+   Read many strings of the same datatype into an array of values in parallel.
+
+   This is a multi-threaded version of exess_read_values(), with the same
+   parameters and return value, except for the additional `n_threads`.
+
+   @param n_threads The maximum number of threads to use, including the
+   calling thread.
+*/
+EXESS_API ExessStatus
+exess_parallel_read_values(unsigned                             n_threads,
+                           ExessDatatype                        datatype,
+                           size_t                               n_values,
+                           const ExessStringView* EXESS_NONNULL strings,
+                           size_t                               out_size,
+                           void* EXESS_NONNULL                  out,
+                           ExessStatus* EXESS_NULLABLE          statuses);
+
+/**
+   Write an array of values to strings in a contiguous heap in parallel.
+
+   This is a multi-threaded version of exess_write_values(), with the same
+   parameters and return value, except for the additional `n_threads`.
+
+   Since the position of every string must be known before it can be written
+   by another thread, this measures every value first, then grows the heap
+   once if necessary, then writes every value.  Measuring is cheaper than
+   writing for most datatypes, but not all, so this is only faster than
+   exess_write_values() with several threads.  The heap may be grown even if
+   some values are invalid.
+
+   @param n_threads The maximum number of threads to use, including the
+   calling thread.
+*/
+EXESS_API ExessStatus
+exess_parallel_write_values(unsigned                            n_threads,
+                            ExessDatatype                       datatype,
+                            size_t                              n_values,
+                            size_t                              values_size,
+                            const void* EXESS_NONNULL           values,
+                            size_t* EXESS_NONNULL               offsets,
+                            size_t* EXESS_NONNULL               heap_size,
+                            char* EXESS_NULLABLE* EXESS_NONNULL heap,
+                            ExessGrowFunc EXESS_NULLABLE        grow,
+                            void* EXESS_NULLABLE                grow_handle);
+
+/**
+   @}
+   @}
+   @defgroup exess_statistics Statistics
+
+   Counts of how often different internal code paths are taken.
+
+   These are only counted if the library was built with statistics enabled,
+   otherwise all counts are always zero.  The counts are global and not
+   synchronized, so may be inaccurate if several threads are converting
+   values at once.
+
+   @{
+*/
+
+/// Counts of code paths taken by the library
+typedef struct {
+  uint64_t double_exact;        ///< Decimals read with exact arithmetic
+  uint64_t double_eisel_lemire; ///< Decimals read with 128-bit powers of 10
+  uint64_t double_soft_float;   ///< Decimals read with 64-bit soft float
+  uint64_t double_bigint;       ///< Decimals read with bigint comparison
+} ExessStats;
+
+/// Return the current counts of code paths taken by the library
+EXESS_API ExessStats
+exess_stats(void);
+
+/// Reset all counts of code paths taken by the library to zero
+EXESS_API void
+exess_reset_stats(void);
+
+/**
    @}
    @}
 */
@@ -1,4 +1,4 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_ATTRIBUTES_H
@@ -7,9 +7,11 @@
 #ifdef __GNUC__
 #  define EXESS_I_PURE_FUNC __attribute__((pure))
 #  define EXESS_I_CONST_FUNC __attribute__((const))
+#  define EXESS_I_TARGET(features) __attribute__((target(features)))
 #else
 #  define EXESS_I_PURE_FUNC
 #  define EXESS_I_CONST_FUNC
+#  define EXESS_I_TARGET(features)
 #endif
 
 #endif // EXESS_SRC_ATTRIBUTES_H
@@ -1,8 +1,10 @@
-// Copyright 2011-2021 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
+#include "base64_simd.h"
 #include "macros.h"
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "string_utils.h"
 #include "write_utils.h"
@@ -10,6 +12,7 @@
 #include <exess/exess.h>
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -43,11 +46,62 @@ unmap(const uint8_t in)
 }
 
 static char
-next_char(const char* const str, size_t* const i)
+next_char(const size_t len, const char* const str, size_t* const i)
 {
-  *i += skip_whitespace(str + *i);
+  *i += skip_whitespace(len - *i, str + *i);
 
-  return str[*i];
+  return peek(len, str, *i);
+}
+
+// Return true if a group of 4 base64 digits is padded correctly
+static inline bool
+is_valid_group(const uint8_t* const in)
+{
+  return in[0] != '=' && in[1] != '=' && (in[2] != '=' || in[3] == '=');
+}
+
+// Decode a valid group of 4 base64 digits and return the number of bytes
+static size_t
+decode_group(const uint8_t* const in, uint8_t* const out)
+{
+  size_t o = 0U;
+
+  const uint8_t a1 = (uint8_t)(unmap(in[0]) << 2U);
+  const uint8_t a2 = unmap(in[1]) >> 4U;
+
+  out[o++] = a1 | a2;
+
+  if (in[2] != '=') {
+    const uint8_t b1 = (uint8_t)(((unsigned)unmap(in[1]) << 4U) & 0xF0U);
+    const uint8_t b2 = unmap(in[2]) >> 2U;
+
+    out[o++] = b1 | b2;
+  }
+
+  if (in[3] != '=') {
+    const uint8_t c1 = (uint8_t)(((unsigned)unmap(in[2]) << 6U) & 0xC0U);
+    const uint8_t c2 = unmap(in[3]);
+
+    out[o++] = c1 | c2;
+  }
+
+  return o;
+}
+
+// Encode up to 3 bytes as a group of 4 base64 digits with any padding
+static void
+encode_group(const size_t n_in, const uint8_t* const data, uint8_t* const out)
+{
+  uint8_t in[4] = {0, 0, 0, 0};
+  memcpy(in, data, n_in);
+
+  out[0] = map(in[0] >> 2U);
+  out[1] = map(((in[0] & 0x03U) << 4U) | ((in[1] & 0xF0U) >> 4U));
+  out[2] =
+    ((n_in > 1U) ? map(((in[1] & 0x0FU) << 2U) | ((in[2] & 0xC0U) >> 6U))
+                 : '=');
+
+  out[3] = ((n_in > 2U) ? map(in[2] & 0x3FU) : '=');
 }
 
 size_t
@@ -57,24 +111,36 @@ exess_decoded_base64_size(const size_t length)
 }
 
 ExessVariableResult
-exess_read_base64(const size_t out_size, void* const out, const char* const str)
+exess_measure_base64(const size_t len, const char* const str)
 {
-  uint8_t* const       uout = (uint8_t*)out;
   const uint8_t* const ustr = (const uint8_t*)str;
   size_t               i    = 0U;
   size_t               o    = 0U;
 
-  while (str[i]) {
+  // Bound the string so the fast path never reads past a null terminator
+  const size_t end = string_length(len, str);
+
+  while (peek(len, str, i)) {
     // Skip leading whitespace
-    i += skip_whitespace(str + i);
-    if (!str[i]) {
+    i += skip_whitespace(len - i, str + i);
+    if (!peek(len, str, i)) {
       break;
     }
 
+    // Check any run of plain digits quickly
+    if (end - i >= BASE64_SIMD_BLOCK_LENGTH) {
+      const size_t n_blocks = measure_base64_blocks(end - i, ustr + i);
+      if (n_blocks) {
+        i += n_blocks;
+        o += n_blocks / 4U * 3U;
+        continue;
+      }
+    }
+
     // Read next chunk of 4 input characters
     uint8_t in[] = {'=', '=', '=', '='};
     for (size_t j = 0; j < 4; ++j) {
-      const char c = next_char(str, &i);
+      const char c = next_char(len, str, &i);
       if (!is_base64(c)) {
         return vresult(EXESS_EXPECTED_BASE64, i, o);
       }
@@ -82,38 +148,87 @@ exess_read_base64(const size_t out_size, void* const out, const char* const str)
       in[j] = ustr[i++];
     }
 
-    if (in[0] == '=' || in[1] == '=' || (in[2] == '=' && in[3] != '=')) {
+    if (!is_valid_group(in)) {
       return vresult(EXESS_BAD_VALUE, i, o);
     }
 
-    const size_t n_bytes = 1U + (in[2] != '=') + (in[3] != '=');
-    if (o + n_bytes > out_size) {
-      return vresult(EXESS_NO_SPACE, i, o);
-    }
+    o += 1U + (in[2] != '=') + (in[3] != '=');
+  }
 
-    const uint8_t a1 = (uint8_t)(unmap(in[0]) << 2U);
-    const uint8_t a2 = unmap(in[1]) >> 4U;
+  return vresult(EXESS_SUCCESS, i, o);
+}
 
-    uout[o++] = a1 | a2;
+ExessVariableResult
+read_base64(const size_t      out_size,
+            void* const       out,
+            const size_t      len,
+            const char* const str)
+{
+  uint8_t* const       uout = (uint8_t*)out;
+  const uint8_t* const ustr = (const uint8_t*)str;
+  size_t               i    = 0U;
+  size_t               o    = 0U;
 
-    if (in[2] != '=') {
-      const uint8_t b1 = (uint8_t)(((unsigned)unmap(in[1]) << 4U) & 0xF0U);
-      const uint8_t b2 = unmap(in[2]) >> 2U;
+  // Bound the string so the fast path never reads past a null terminator
+  const size_t end = string_length(len, str);
 
-      uout[o++] = b1 | b2;
+  while (peek(len, str, i)) {
+    // Skip leading whitespace
+    i += skip_whitespace(len - i, str + i);
+    if (!peek(len, str, i)) {
+      break;
     }
 
-    if (in[3] != '=') {
-      const uint8_t c1 = (uint8_t)(((unsigned)unmap(in[2]) << 6U) & 0xC0U);
-      const uint8_t c2 = unmap(in[3]);
+    // Decode any run of plain digits quickly
+    if (end - i >= BASE64_SIMD_BLOCK_LENGTH) {
+      const size_t n_blocks =
+        decode_base64_blocks(end - i, ustr + i, out_size - o, uout + o);
+      if (n_blocks) {
+        i += n_blocks;
+        o += n_blocks / 4U * 3U;
+        continue;
+      }
+    }
 
-      uout[o++] = c1 | c2;
+    // Read next chunk of 4 input characters
+    uint8_t in[] = {'=', '=', '=', '='};
+    for (size_t j = 0; j < 4; ++j) {
+      const char c = next_char(len, str, &i);
+      if (!is_base64(c)) {
+        return vresult(EXESS_EXPECTED_BASE64, i, o);
+      }
+
+      in[j] = ustr[i++];
     }
+
+    if (!is_valid_group(in)) {
+      return vresult(EXESS_BAD_VALUE, i, o);
+    }
+
+    const size_t n_bytes = 1U + (in[2] != '=') + (in[3] != '=');
+    if (o + n_bytes > out_size) {
+      return vresult(EXESS_NO_SPACE, i, o);
+    }
+
+    o += decode_group(in, uout + o);
   }
 
   return vresult(EXESS_SUCCESS, i, o);
 }
 
+ExessVariableResult
+exess_read_base64(const size_t out_size, void* const out, const char* const str)
+{
+  return read_base64(out_size, out, SIZE_MAX, str);
+}
+
+ExessVariableResult
+exess_read_base64_in_place(const size_t len, char* const str)
+{
+  // Decoding never writes past the characters that have already been read
+  return read_base64(len, str, len, str);
+}
+
 ExessResult
 exess_write_base64(const size_t      data_size,
                    const void* const data,
@@ -131,20 +246,161 @@ exess_write_base64(const size_t      data_size,
 
   uint8_t* const out = (uint8_t*)buf;
 
-  size_t o = 0;
-  for (size_t i = 0; i < data_size; i += 3, o += 4) {
-    uint8_t      in[4] = {0, 0, 0, 0};
-    const size_t n_in  = MIN(3, data_size - i);
-    memcpy(in, (const uint8_t*)data + i, n_in);
-
-    out[o]     = map(in[0] >> 2U);
-    out[o + 1] = map(((in[0] & 0x03U) << 4U) | ((in[1] & 0xF0U) >> 4U));
-    out[o + 2] =
-      ((n_in > 1U) ? map(((in[1] & 0x0FU) << 2U) | ((in[2] & 0xC0U) >> 6U))
-                   : '=');
+  // Encode most of the data quickly, then the remainder with any padding
+  const size_t n_fast =
+    encode_base64_blocks(data_size, (const uint8_t*)data, out);
 
-    out[o + 3] = ((n_in > 2U) ? map(in[2] & 0x3FU) : '=');
+  size_t o = n_fast / 3U * 4U;
+  for (size_t i = n_fast; i < data_size; i += 3, o += 4) {
+    encode_group(MIN(3, data_size - i), (const uint8_t*)data + i, out + o);
   }
 
   return end_write(EXESS_SUCCESS, buf_size, buf, o);
 }
+
+void
+exess_base64_decoder_init(ExessBase64Decoder* const decoder)
+{
+  memset(decoder, 0, sizeof(ExessBase64Decoder));
+}
+
+ExessVariableResult
+exess_base64_decoder_feed(ExessBase64Decoder* const decoder,
+                          const size_t              len,
+                          const char* const         chunk,
+                          const size_t              out_size,
+                          void* const               out)
+{
+  uint8_t* const       uout = (uint8_t*)out;
+  const uint8_t* const ustr = (const uint8_t*)chunk;
+  size_t               i    = 0U;
+  size_t               o    = 0U;
+
+  while (i < len) {
+    i += skip_whitespace(len - i, chunk + i);
+    if (i == len) {
+      break;
+    }
+
+    // Decode any run of plain digits quickly if we're between groups
+    if (!decoder->n_chars && len - i >= BASE64_SIMD_BLOCK_LENGTH) {
+      const size_t n_blocks =
+        decode_base64_blocks(len - i, ustr + i, out_size - o, uout + o);
+      if (n_blocks) {
+        i += n_blocks;
+        o += n_blocks / 4U * 3U;
+        continue;
+      }
+    }
+
+    if (!is_base64(chunk[i])) {
+      return vresult(EXESS_EXPECTED_BASE64, i, o);
+    }
+
+    // Add the character to the group, and continue if it's incomplete
+    uint8_t* const in = decoder->chars;
+    in[decoder->n_chars] = ustr[i];
+    if (decoder->n_chars < 3U) {
+      ++decoder->n_chars;
+      ++i;
+      continue;
+    }
+
+    if (!is_valid_group(in)) {
+      return vresult(EXESS_BAD_VALUE, i + 1U, o);
+    }
+
+    // Leave the last character unread if there's no space for the group
+    const size_t n_bytes = 1U + (in[2] != '=') + (in[3] != '=');
+    if (o + n_bytes > out_size) {
+      return vresult(EXESS_NO_SPACE, i, o);
+    }
+
+    o += decode_group(in, uout + o);
+    decoder->n_chars = 0U;
+    ++i;
+  }
+
+  return vresult(EXESS_SUCCESS, i, o);
+}
+
+ExessStatus
+exess_base64_decoder_finish(const ExessBase64Decoder* const decoder)
+{
+  return decoder->n_chars ? EXESS_EXPECTED_BASE64 : EXESS_SUCCESS;
+}
+
+void
+exess_base64_encoder_init(ExessBase64Encoder* const encoder)
+{
+  memset(encoder, 0, sizeof(ExessBase64Encoder));
+}
+
+ExessVariableResult
+exess_base64_encoder_feed(ExessBase64Encoder* const encoder,
+                          const size_t              data_size,
+                          const void* const         data,
+                          const size_t              buf_size,
+                          char* const               buf)
+{
+  const uint8_t* const in  = (const uint8_t*)data;
+  uint8_t* const       out = (uint8_t*)buf;
+  size_t               i   = 0U;
+  size_t               o   = 0U;
+
+  // Complete any group started by a previous chunk
+  while (encoder->n_bytes && encoder->n_bytes < 3U && i < data_size) {
+    encoder->bytes[encoder->n_bytes++] = in[i++];
+  }
+
+  if (encoder->n_bytes == 3U) {
+    if (buf_size < 4U) {
+      return vresult(EXESS_NO_SPACE, i, o);
+    }
+
+    encode_group(3U, encoder->bytes, out);
+    encoder->n_bytes = 0U;
+    o += 4U;
+  } else if (encoder->n_bytes) {
+    return vresult(EXESS_SUCCESS, i, o);
+  }
+
+  // Encode as many whole groups as fit, mostly quickly
+  const size_t n_groups = MIN((data_size - i) / 3U, (buf_size - o) / 4U);
+  const size_t n_whole  = n_groups * 3U;
+  const size_t n_fast   = encode_base64_blocks(n_whole, in + i, out + o);
+
+  o += n_fast / 3U * 4U;
+  for (size_t j = n_fast; j < n_whole; j += 3U, o += 4U) {
+    encode_group(3U, in + i + j, out + o);
+  }
+
+  i += n_whole;
+
+  // Save any trailing bytes for the next group
+  if (data_size - i < 3U) {
+    memcpy(encoder->bytes, in + i, data_size - i);
+    encoder->n_bytes = (uint8_t)(data_size - i);
+    return vresult(EXESS_SUCCESS, data_size, o);
+  }
+
+  return vresult(EXESS_NO_SPACE, i, o);
+}
+
+ExessResult
+exess_base64_encoder_finish(ExessBase64Encoder* const encoder,
+                            const size_t              buf_size,
+                            char* const               buf)
+{
+  if (!encoder->n_bytes) {
+    return result(EXESS_SUCCESS, 0U);
+  }
+
+  if (buf_size < 4U) {
+    return result(EXESS_NO_SPACE, 0U);
+  }
+
+  encode_group(encoder->n_bytes, encoder->bytes, (uint8_t*)buf);
+  encoder->n_bytes = 0U;
+  return result(EXESS_SUCCESS, 4U);
+}
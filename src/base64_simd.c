@@ -0,0 +1,546 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+/*
+  Vectorized base64 decoding and encoding.
+
+  These are the algorithms described in "Faster Base64 Encoding and Decoding
+  using AVX2 Instructions" and "Base64 encoding and decoding at almost the
+  speed of a memory copy" by Wojciech Muła and Daniel Lemire.  Each kernel
+  only handles whole blocks of valid digits, so the scalar code in base64.c
+  deals with whitespace, padding, errors, and any remaining characters.
+*/
+
+#include "base64_simd.h"
+
+#include "attributes.h"
+#include "cpu.h"
+#include "exess_config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if USE_X86_SIMD
+
+#  include <immintrin.h>
+
+/// Validate and translate 16 base64 digits to their 6-bit values in place
+EXESS_I_TARGET("sse4.1")
+static inline int
+translate_16(__m128i* const digits)
+{
+  const __m128i lut_lo = _mm_setr_epi8(0x15,
+                                       0x11,
+                                       0x11,
+                                       0x11,
+                                       0x11,
+                                       0x11,
+                                       0x11,
+                                       0x11,
+                                       0x11,
+                                       0x11,
+                                       0x13,
+                                       0x1A,
+                                       0x1B,
+                                       0x1B,
+                                       0x1B,
+                                       0x1A);
+
+  const __m128i lut_hi = _mm_setr_epi8(0x10,
+                                       0x10,
+                                       0x01,
+                                       0x02,
+                                       0x04,
+                                       0x08,
+                                       0x04,
+                                       0x08,
+                                       0x10,
+                                       0x10,
+                                       0x10,
+                                       0x10,
+                                       0x10,
+                                       0x10,
+                                       0x10,
+                                       0x10);
+
+  const __m128i lut_roll =
+    _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+  const __m128i in = *digits;
+  const __m128i hi = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0F));
+  const __m128i lo = _mm_and_si128(in, _mm_set1_epi8(0x0F));
+
+  // Every invalid character has a bit in common in the two lookups
+  if (!_mm_testz_si128(_mm_shuffle_epi8(lut_lo, lo),
+                       _mm_shuffle_epi8(lut_hi, hi))) {
+    return 0;
+  }
+
+  // Offset by an amount determined by the high nibble, or specially for '/'
+  const __m128i is_slash = _mm_cmpeq_epi8(in, _mm_set1_epi8(0x2F));
+  const __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(is_slash, hi));
+
+  *digits = _mm_add_epi8(in, roll);
+  return 1;
+}
+
+/// Pack 16 6-bit values into 12 bytes at the start of the result
+EXESS_I_TARGET("sse4.1")
+static inline __m128i
+pack_16(const __m128i values)
+{
+  // Merge pairs into 12-bit values, then pairs of those into 24-bit values
+  const __m128i merged_ab =
+    _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const __m128i merged =
+    _mm_madd_epi16(merged_ab, _mm_set1_epi32(0x00011000));
+
+  // Pack the bytes of each 24-bit value in big-endian order
+  return _mm_shuffle_epi8(
+    merged,
+    _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+EXESS_I_TARGET("sse4.1")
+static size_t
+decode_sse41(const size_t         len,
+             const uint8_t* const str,
+             const size_t         out_size,
+             uint8_t* const       out)
+{
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; len - i >= 16U && out_size - o >= 12U; i += 16U, o += 12U) {
+    __m128i values = _mm_loadu_si128((const void*)(str + i));
+    if (!translate_16(&values)) {
+      break;
+    }
+
+    // Store exactly 12 bytes, since the caller's buffer may hold other data
+    const __m128i packed = pack_16(values);
+    const int32_t tail   = _mm_extract_epi32(packed, 2);
+
+    _mm_storel_epi64((void*)(out + o), packed);
+    memcpy(out + o + 8U, &tail, sizeof(tail));
+  }
+
+  return i;
+}
+
+EXESS_I_TARGET("avx2")
+static size_t
+decode_avx2(const size_t         len,
+            const uint8_t* const str,
+            const size_t         out_size,
+            uint8_t* const       out)
+{
+  if (len < 32U || out_size < 24U) {
+    return 0U;
+  }
+
+  const __m256i lut_lo = _mm256_setr_epi8(
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+    0x1B, 0x1B, 0x1B, 0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+
+  const __m256i lut_hi = _mm256_setr_epi8(
+    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+
+  const __m256i lut_roll = _mm256_setr_epi8(
+    0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+  const __m256i pack_bytes = _mm256_setr_epi8(
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+  const __m256i pack_lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; len - i >= 32U && out_size - o >= 24U; i += 32U, o += 24U) {
+    const __m256i in = _mm256_loadu_si256((const void*)(str + i));
+    const __m256i hi =
+      _mm256_and_si256(_mm256_srli_epi32(in, 4), _mm256_set1_epi8(0x0F));
+    const __m256i lo = _mm256_and_si256(in, _mm256_set1_epi8(0x0F));
+
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo),
+                            _mm256_shuffle_epi8(lut_hi, hi))) {
+      break;
+    }
+
+    const __m256i is_slash = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(0x2F));
+    const __m256i roll =
+      _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(is_slash, hi));
+
+    const __m256i values = _mm256_add_epi8(in, roll);
+    const __m256i merged_ab =
+      _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    const __m256i merged =
+      _mm256_madd_epi16(merged_ab, _mm256_set1_epi32(0x00011000));
+
+    const __m256i packed = _mm256_permutevar8x32_epi32(
+      _mm256_shuffle_epi8(merged, pack_bytes), pack_lanes);
+
+    // Store exactly 24 bytes, since the caller's buffer may hold other data
+    _mm_storeu_si128((void*)(out + o), _mm256_castsi256_si128(packed));
+    _mm_storel_epi64((void*)(out + o + 16U),
+                     _mm256_extracti128_si256(packed, 1));
+  }
+
+  return i;
+}
+
+/// Table that maps ASCII characters to 6-bit values, or 0x80 if invalid
+static const uint8_t avx512_unmap[128] = {
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 62,   0x80, 0x80, 0x80, 63,
+  52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0,    1,    2,    3,    4,    5,    6,
+  7,    8,    9,    10,   11,   12,   13,   14,   15,   16,   17,   18,
+  19,   20,   21,   22,   23,   24,   25,   0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 26,   27,   28,   29,   30,   31,   32,   33,   34,   35,   36,
+  37,   38,   39,   40,   41,   42,   43,   44,   45,   46,   47,   48,
+  49,   50,   51,   0x80, 0x80, 0x80, 0x80, 0x80};
+
+/// Indices of the bytes of each 24-bit value in big-endian order
+static const uint8_t avx512_pack[64] = {
+  2,  1,  0,  6,  5,  4,  10, 9,  8,  14, 13, 12, 18, 17, 16, 22,
+  21, 20, 26, 25, 24, 30, 29, 28, 34, 33, 32, 38, 37, 36, 42, 41,
+  40, 46, 45, 44, 50, 49, 48, 54, 53, 52, 58, 57, 56, 62, 61, 60,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0};
+
+EXESS_I_TARGET("avx512f,avx512bw,avx512vbmi")
+static size_t
+decode_avx512(const size_t         len,
+              const uint8_t* const str,
+              const size_t         out_size,
+              uint8_t* const       out)
+{
+  if (len < 64U || out_size < 48U) {
+    return 0U;
+  }
+
+  const __m512i unmap_lo = _mm512_loadu_si512((const void*)avx512_unmap);
+  const __m512i unmap_hi = _mm512_loadu_si512((const void*)(avx512_unmap + 64));
+  const __m512i pack     = _mm512_loadu_si512((const void*)avx512_pack);
+
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; len - i >= 64U && out_size - o >= 48U; i += 64U, o += 48U) {
+    const __m512i in = _mm512_loadu_si512((const void*)(str + i));
+    const __m512i values = _mm512_permutex2var_epi8(unmap_lo, in, unmap_hi);
+
+    // Invalid characters and non-ASCII bytes both have the high bit set
+    if (_mm512_movepi8_mask(_mm512_or_si512(values, in))) {
+      break;
+    }
+
+    const __m512i merged_ab =
+      _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+    const __m512i merged =
+      _mm512_madd_epi16(merged_ab, _mm512_set1_epi32(0x00011000));
+
+    _mm512_mask_storeu_epi8(out + o,
+                            (__mmask64)0x0000FFFFFFFFFFFFULL,
+                            _mm512_permutexvar_epi8(pack, merged));
+  }
+
+  return i;
+}
+
+/// Split 12 bytes into 16 6-bit values, one in each byte of the result
+EXESS_I_TARGET("sse4.1")
+static inline __m128i
+unpack_12(const __m128i bytes)
+{
+  const __m128i in = _mm_shuffle_epi8(
+    bytes, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+  return _mm_or_si128(t1, t3);
+}
+
+/// Map 16 6-bit values to base64 digits
+EXESS_I_TARGET("sse4.1")
+static inline __m128i
+map_16(const __m128i values)
+{
+  const __m128i shift_lut = _mm_setr_epi8('a' - 26,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '+' - 62,
+                                          '/' - 63,
+                                          'A',
+                                          0,
+                                          0);
+
+  // Reduce to an index into shift_lut: 0 for a-z, 1-10 for digits, and so on
+  const __m128i less_26 = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+  const __m128i index =
+    _mm_or_si128(_mm_subs_epu8(values, _mm_set1_epi8(51)),
+                 _mm_and_si128(less_26, _mm_set1_epi8(13)));
+
+  return _mm_add_epi8(values, _mm_shuffle_epi8(shift_lut, index));
+}
+
+EXESS_I_TARGET("sse4.1")
+static size_t
+encode_sse41(const size_t size, const uint8_t* const data, uint8_t* const out)
+{
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; size - i >= 16U; i += 12U, o += 16U) {
+    const __m128i bytes = _mm_loadu_si128((const void*)(data + i));
+
+    _mm_storeu_si128((void*)(out + o), map_16(unpack_12(bytes)));
+  }
+
+  return i;
+}
+
+EXESS_I_TARGET("avx2")
+static size_t
+encode_avx2(const size_t size, const uint8_t* const data, uint8_t* const out)
+{
+  const __m256i shuffle = _mm256_setr_epi8(
+    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+  const __m256i shift_lut = _mm256_setr_epi8(
+    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; size - i >= 28U; i += 24U, o += 32U) {
+    // Load 12 bytes into each lane
+    const __m128i lo = _mm_loadu_si128((const void*)(data + i));
+    const __m128i hi = _mm_loadu_si128((const void*)(data + i + 12U));
+    const __m256i bytes =
+      _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+    const __m256i in = _mm256_shuffle_epi8(bytes, shuffle);
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i values = _mm256_or_si256(t1, t3);
+
+    const __m256i less_26 = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+    const __m256i index =
+      _mm256_or_si256(_mm256_subs_epu8(values, _mm256_set1_epi8(51)),
+                      _mm256_and_si256(less_26, _mm256_set1_epi8(13)));
+
+    const __m256i digits =
+      _mm256_add_epi8(values, _mm256_shuffle_epi8(shift_lut, index));
+
+    _mm256_storeu_si256((void*)(out + o), digits);
+  }
+
+  return i;
+}
+
+/// Indices of the source bytes for each group of 4 6-bit values
+static const uint8_t avx512_spread[64] = {
+  1,  0,  2,  1,  4,  3,  5,  4,  7,  6,  8,  7,  10, 9,  11, 10,
+  13, 12, 14, 13, 16, 15, 17, 16, 19, 18, 20, 19, 22, 21, 23, 22,
+  25, 24, 26, 25, 28, 27, 29, 28, 31, 30, 32, 31, 34, 33, 35, 34,
+  37, 36, 38, 37, 40, 39, 41, 40, 43, 42, 44, 43, 46, 45, 47, 46};
+
+static const uint8_t avx512_map[64] = {
+  'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
+  'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
+  'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
+  'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
+  '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'};
+
+EXESS_I_TARGET("avx512f,avx512bw,avx512vbmi")
+static size_t
+encode_avx512(const size_t size, const uint8_t* const data, uint8_t* const out)
+{
+  const __m512i spread  = _mm512_loadu_si512((const void*)avx512_spread);
+  const __m512i map     = _mm512_loadu_si512((const void*)avx512_map);
+  const __m512i offsets = _mm512_set1_epi64(0x3036242A1016040ALL);
+
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; size - i >= 48U; i += 48U, o += 64U) {
+    const __m512i bytes =
+      _mm512_maskz_loadu_epi8((__mmask64)0x0000FFFFFFFFFFFFULL, data + i);
+
+    const __m512i in     = _mm512_permutexvar_epi8(spread, bytes);
+    const __m512i values = _mm512_multishift_epi64_epi8(offsets, in);
+
+    _mm512_storeu_si512((void*)(out + o), _mm512_permutexvar_epi8(values, map));
+  }
+
+  return i;
+}
+
+EXESS_I_TARGET("sse4.1")
+static size_t
+measure_sse41(const size_t len, const uint8_t* const str)
+{
+  size_t i = 0U;
+
+  for (; len - i >= 16U; i += 16U) {
+    __m128i values = _mm_loadu_si128((const void*)(str + i));
+    if (!translate_16(&values)) {
+      break;
+    }
+  }
+
+  return i;
+}
+
+EXESS_I_TARGET("avx512f,avx512bw,avx512vbmi")
+static size_t
+measure_avx512(const size_t len, const uint8_t* const str)
+{
+  if (len < 64U) {
+    return 0U;
+  }
+
+  const __m512i unmap_lo = _mm512_loadu_si512((const void*)avx512_unmap);
+  const __m512i unmap_hi = _mm512_loadu_si512((const void*)(avx512_unmap + 64));
+
+  size_t i = 0U;
+
+  for (; len - i >= 64U; i += 64U) {
+    const __m512i in = _mm512_loadu_si512((const void*)(str + i));
+    const __m512i values = _mm512_permutex2var_epi8(unmap_lo, in, unmap_hi);
+
+    if (_mm512_movepi8_mask(_mm512_or_si512(values, in))) {
+      break;
+    }
+  }
+
+  return i;
+}
+
+size_t
+measure_base64_blocks(const size_t len, const uint8_t* const str)
+{
+  size_t i = 0U;
+
+  if (cpu_supports(CPU_AVX512VBMI | CPU_AVX512BW)) {
+    i += measure_avx512(len, str);
+  }
+
+  if (cpu_supports(CPU_SSE41)) {
+    i += measure_sse41(len - i, str + i);
+  }
+
+  return i;
+}
+
+size_t
+decode_base64_blocks(const size_t         len,
+                     const uint8_t* const str,
+                     const size_t         out_size,
+                     uint8_t* const       out)
+{
+  size_t i = 0U;
+  size_t o = 0U;
+
+  // Use the widest kernels first, then narrower ones for what's left
+  if (cpu_supports(CPU_AVX512VBMI | CPU_AVX512BW)) {
+    i += decode_avx512(len, str, out_size, out);
+    o = i / 4U * 3U;
+  }
+
+  if (cpu_supports(CPU_AVX2)) {
+    i += decode_avx2(len - i, str + i, out_size - o, out + o);
+    o = i / 4U * 3U;
+  }
+
+  if (cpu_supports(CPU_SSE41)) {
+    i += decode_sse41(len - i, str + i, out_size - o, out + o);
+  }
+
+  return i;
+}
+
+size_t
+encode_base64_blocks(const size_t         size,
+                     const uint8_t* const data,
+                     uint8_t* const       out)
+{
+  size_t i = 0U;
+
+  if (cpu_supports(CPU_AVX512VBMI | CPU_AVX512BW)) {
+    i += encode_avx512(size, data, out);
+  }
+
+  if (cpu_supports(CPU_AVX2)) {
+    i += encode_avx2(size - i, data + i, out + (i / 3U * 4U));
+  }
+
+  if (cpu_supports(CPU_SSE41)) {
+    i += encode_sse41(size - i, data + i, out + (i / 3U * 4U));
+  }
+
+  return i;
+}
+
+#else
+
+size_t
+measure_base64_blocks(const size_t len, const uint8_t* const str)
+{
+  (void)len;
+  (void)str;
+  return 0U;
+}
+
+size_t
+decode_base64_blocks(const size_t         len,
+                     const uint8_t* const str,
+                     const size_t         out_size,
+                     uint8_t* const       out)
+{
+  (void)len;
+  (void)str;
+  (void)out_size;
+  (void)out;
+  return 0U;
+}
+
+size_t
+encode_base64_blocks(const size_t         size,
+                     const uint8_t* const data,
+                     uint8_t* const       out)
+{
+  (void)size;
+  (void)data;
+  (void)out;
+  return 0U;
+}
+
+#endif // USE_X86_SIMD
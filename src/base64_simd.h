@@ -0,0 +1,61 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_BASE64_SIMD_H
+#define EXESS_SRC_BASE64_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// The number of characters in the smallest block that SIMD kernels handle
+#define BASE64_SIMD_BLOCK_LENGTH 16U
+
+/**
+   Validate as many leading blocks of base64 characters as possible with SIMD.
+
+   This is like decode_base64_blocks(), but only checks the input.
+
+   @param len The number of characters available in `str`.
+   @param str Base64 characters to check.
+
+   @return The number of characters validated, which is a multiple of 4 that
+   decodes to 3 bytes for every 4 characters.
+*/
+size_t
+measure_base64_blocks(size_t len, const uint8_t* str);
+
+/**
+   Decode as many leading blocks of base64 characters as possible with SIMD.
+
+   This only decodes whole blocks which contain only base64 digits (no
+   whitespace, padding, or invalid characters), and stops at the first block
+   that doesn't, so the caller can handle the rest like usual.
+
+   @param len The number of characters available in `str`.
+   @param str Base64 characters to decode.
+   @param out_size The number of bytes available in `out`.
+   @param out Output buffer for decoded bytes.
+
+   @return The number of characters decoded, which is a multiple of 4 and
+   writes 3 bytes to `out` for every 4 characters.
+*/
+size_t
+decode_base64_blocks(size_t         len,
+                     const uint8_t* str,
+                     size_t         out_size,
+                     uint8_t*       out);
+
+/**
+   Encode as many leading blocks of bytes as possible to base64 with SIMD.
+
+   @param size The number of bytes available in `data`.
+   @param data Bytes to encode.
+   @param out Output buffer, which must have space for the encoded data.
+
+   @return The number of bytes encoded, which is a multiple of 3 and writes 4
+   characters to `out` for every 3 bytes.
+*/
+size_t
+encode_base64_blocks(size_t size, const uint8_t* data, uint8_t* out);
+
+#endif // EXESS_SRC_BASE64_SIMD_H
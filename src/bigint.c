@@ -1,4 +1,4 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "bigint.h"
@@ -9,11 +9,22 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdlib.h>
-
+#include <string.h>
+
+/*
+  Only the first n_bigits of a bigint are ever read or written, so
+  operations on the small numbers which are common in practice only touch a
+  few bigits, and the rest of the array may be uninitialized.
+*/
+
+/// An unsigned integer large enough for the product of two bigits
+#if USE_INT128
+typedef ExessNativeUint128 Hugit;
+#else
 typedef uint64_t Hugit;
+#endif
 
-static const uint32_t bigit_mask = ~0U;
-static const uint64_t carry_mask = (uint64_t)~0U << 32U;
+static const Bigit bigit_mask = (Bigit)~(Bigit)0U;
 
 typedef struct {
   unsigned bigits;
@@ -30,6 +41,13 @@ make_offset(const unsigned i)
   return offset;
 }
 
+/// Return the bigit at `index`, or zero if it's past the most significant one
+static inline Bigit
+exess_bigint_bigit(const ExessBigint* num, const unsigned index)
+{
+  return index < num->n_bigits ? num->bigits[index] : 0U;
+}
+
 #ifndef NDEBUG
 static inline bool
 exess_bigint_is_clamped(const ExessBigint* num)
@@ -46,23 +64,29 @@ exess_bigint_shift_left(ExessBigint* num, const unsigned amount)
     return;
   }
 
-  const Offset offset = make_offset(amount);
+  const Offset   offset = make_offset(amount);
+  const unsigned n      = num->n_bigits;
 
-  assert(num->n_bigits + offset.bigits < BIGINT_MAX_BIGITS);
-  num->n_bigits += offset.bigits + (bool)offset.bits;
+  assert(n + offset.bigits < BIGINT_MAX_BIGITS);
 
   if (offset.bits == 0) { // Simple bigit-aligned shift
-    for (unsigned i = num->n_bigits - 1; i >= offset.bigits; --i) {
-      num->bigits[i] = num->bigits[i - offset.bigits];
+    for (unsigned i = n; i-- > 0;) {
+      num->bigits[i + offset.bigits] = num->bigits[i];
     }
+
+    num->n_bigits = n + offset.bigits;
   } else { // Bigit + sub-bigit bit offset shift
     const unsigned right_shift = BIGINT_BIGIT_BITS - offset.bits;
-    for (unsigned i = num->n_bigits - offset.bigits - 1; i > 0; --i) {
+    const Bigit    top         = num->bigits[n - 1] >> right_shift;
+
+    num->bigits[n + offset.bigits] = top;
+    for (unsigned i = n - 1; i > 0; --i) {
       num->bigits[i + offset.bigits] =
         (num->bigits[i] << offset.bits) | (num->bigits[i - 1] >> right_shift);
     }
 
     num->bigits[offset.bigits] = num->bigits[0] << offset.bits;
+    num->n_bigits              = n + offset.bigits + (top != 0U);
   }
 
   // Zero LSBs
@@ -70,22 +94,22 @@ exess_bigint_shift_left(ExessBigint* num, const unsigned amount)
     num->bigits[i] = 0;
   }
 
-  exess_bigint_clamp(num);
   assert(exess_bigint_is_clamped(num));
 }
 
 void
 exess_bigint_zero(ExessBigint* num)
 {
-  static const ExessBigint zero = {{0}, 0};
-
-  *num = zero;
+  num->n_bigits = 0U;
 }
 
 void
 exess_bigint_set(ExessBigint* num, const ExessBigint* value)
 {
-  *num = *value;
+  if (num != value) {
+    memcpy(num->bigits, value->bigits, value->n_bigits * sizeof(Bigit));
+    num->n_bigits = value->n_bigits;
+  }
 }
 
 void
@@ -110,9 +134,14 @@ exess_bigint_set_u64(ExessBigint* num, const uint64_t value)
 {
   exess_bigint_zero(num);
 
+#if BIGINT_BIGIT_BITS == 64U
+  num->bigits[0] = value;
+  num->n_bigits  = (bool)value;
+#else
   num->bigits[0] = (Bigit)(value & bigit_mask);
   num->bigits[1] = (Bigit)(value >> BIGINT_BIGIT_BITS);
   num->n_bigits  = num->bigits[1] ? 2U : num->bigits[0] ? 1U : 0U;
+#endif
 }
 
 void
@@ -156,8 +185,9 @@ exess_bigint_set_decimal_string(ExessBigint* num, const char* const str)
   exess_bigint_clamp(num);
 }
 
-void
-exess_bigint_multiply_u32(ExessBigint* num, const uint32_t factor)
+// Multiply by a factor that fits in a single bigit
+static void
+exess_bigint_multiply_bigit(ExessBigint* num, const Bigit factor)
 {
   switch (factor) {
   case 0:
@@ -169,25 +199,32 @@ exess_bigint_multiply_u32(ExessBigint* num, const uint32_t factor)
     break;
   }
 
-  Hugit carry = 0;
+  Bigit carry = 0;
   for (unsigned i = 0; i < num->n_bigits; ++i) {
-    const Hugit p     = (Hugit)factor * num->bigits[i];
-    const Hugit hugit = p + (carry & bigit_mask);
+    const Hugit p = ((Hugit)factor * num->bigits[i]) + carry;
 
-    num->bigits[i] = (Bigit)(hugit & bigit_mask);
-
-    carry = (hugit >> 32U) + (carry >> 32U);
+    num->bigits[i] = (Bigit)(p & bigit_mask);
+    carry          = (Bigit)(p >> BIGINT_BIGIT_BITS);
   }
 
-  for (; carry; carry >>= 32U) {
+  if (carry) {
     assert(num->n_bigits + 1 <= BIGINT_MAX_BIGITS);
-    num->bigits[num->n_bigits++] = (Bigit)carry;
+    num->bigits[num->n_bigits++] = carry;
   }
 }
 
+void
+exess_bigint_multiply_u32(ExessBigint* num, const uint32_t factor)
+{
+  exess_bigint_multiply_bigit(num, factor);
+}
+
 void
 exess_bigint_multiply_u64(ExessBigint* num, const uint64_t factor)
 {
+#if BIGINT_BIGIT_BITS == 64U
+  exess_bigint_multiply_bigit(num, factor);
+#else
   switch (factor) {
   case 0:
     exess_bigint_zero(num);
@@ -215,6 +252,7 @@ exess_bigint_multiply_u64(ExessBigint* num, const uint64_t factor)
     assert(num->n_bigits + 1 <= BIGINT_MAX_BIGITS);
     num->bigits[num->n_bigits++] = (Bigit)(carry & bigit_mask);
   }
+#endif
 }
 
 void
@@ -308,14 +346,21 @@ exess_bigint_plus_compare_internal(const ExessBigint* const l,
     return 1;
   }
 
-  if (p->n_bigits < l->n_bigits && l->n_bigits < c->n_bigits) {
-    return -1;
+  // The sum may have one more bigit than `l`, in which case that's all of `c`
+  Hugit    borrow = 0;
+  unsigned i      = c->n_bigits;
+  if (i > l->n_bigits) {
+    borrow = c->bigits[--i];
+    if (borrow > 1) {
+      return -1;
+    }
+
+    borrow <<= BIGINT_BIGIT_BITS;
   }
 
-  Hugit borrow = 0;
-  for (int i = (int)c->n_bigits - 1; i >= 0; --i) {
+  while (i-- > 0) {
     const Bigit ai  = l->bigits[i];
-    const Bigit bi  = p->bigits[i];
+    const Bigit bi  = exess_bigint_bigit(p, i);
     const Bigit ci  = c->bigits[i];
     const Hugit sum = (Hugit)ai + bi;
 
@@ -328,7 +373,7 @@ exess_bigint_plus_compare_internal(const ExessBigint* const l,
       return -1;
     }
 
-    borrow <<= 32U;
+    borrow <<= BIGINT_BIGIT_BITS;
   }
 
   return borrow ? -1 : 0;
@@ -351,10 +396,13 @@ exess_bigint_plus_compare(const ExessBigint* const l,
 static unsigned
 exess_bigint_add_carry(ExessBigint* lhs, unsigned i, bool carry)
 {
-  for (; carry; ++i) {
-    const Hugit sum = (Hugit)carry + lhs->bigits[i];
-    lhs->bigits[i]  = (Bigit)(sum & bigit_mask);
-    carry           = (Bigit)((sum & carry_mask) >> 32U);
+  for (; carry && i < lhs->n_bigits; ++i) {
+    carry = !++lhs->bigits[i];
+  }
+
+  if (carry) {
+    assert(i < BIGINT_MAX_BIGITS);
+    lhs->bigits[i++] = 1U;
   }
 
   return i;
@@ -369,7 +417,7 @@ exess_bigint_add_u32(ExessBigint* lhs, const uint32_t rhs)
   }
 
   Hugit sum   = (Hugit)lhs->bigits[0] + rhs;
-  Bigit carry = (Bigit)(sum >> 32U);
+  bool  carry = (bool)(sum >> BIGINT_BIGIT_BITS);
 
   lhs->bigits[0] = (Bigit)(sum & bigit_mask);
 
@@ -386,10 +434,11 @@ exess_bigint_add(ExessBigint* lhs, const ExessBigint* rhs)
   bool     carry = 0;
   unsigned i     = 0;
   for (; i < rhs->n_bigits; ++i) {
-    const Hugit sum = (Hugit)lhs->bigits[i] + rhs->bigits[i] + carry;
+    const Hugit sum =
+      (Hugit)exess_bigint_bigit(lhs, i) + rhs->bigits[i] + carry;
 
     lhs->bigits[i] = (Bigit)(sum & bigit_mask);
-    carry          = (sum & carry_mask) >> 32U;
+    carry          = (bool)(sum >> BIGINT_BIGIT_BITS);
   }
 
   i             = exess_bigint_add_carry(lhs, i, carry);
@@ -435,8 +484,15 @@ exess_bigint_subtract(ExessBigint* lhs, const ExessBigint* rhs)
 static unsigned
 exess_bigint_leading_zeros(const ExessBigint* num)
 {
-  return (32 * (BIGINT_MAX_BIGITS - num->n_bigits)) +
-         exess_clz32(num->bigits[num->n_bigits - 1]);
+  const Bigit top = num->bigits[num->n_bigits - 1];
+
+#if BIGINT_BIGIT_BITS == 64U
+  const unsigned top_zeros = exess_clz64(top);
+#else
+  const unsigned top_zeros = exess_clz32(top);
+#endif
+
+  return (BIGINT_BIGIT_BITS * (BIGINT_MAX_BIGITS - num->n_bigits)) + top_zeros;
 }
 
 static Bigit
@@ -444,26 +500,23 @@ exess_bigint_left_shifted_bigit_i(const ExessBigint* num,
                                   const Offset       amount,
                                   const unsigned     index)
 {
-  if (amount.bigits == 0 && amount.bits == 0) {
-    return num->bigits[index];
-  }
-
   if (index < amount.bigits) {
     return 0;
   }
 
+  const unsigned i = index - amount.bigits;
   if (amount.bits == 0) { // Simple bigit-aligned shift
-    return num->bigits[index - amount.bigits];
+    return exess_bigint_bigit(num, i);
   }
 
-  if (index == amount.bigits) { // Last non-zero bigit
-    return num->bigits[0] << amount.bits;
+  if (i == 0) { // Last non-zero bigit
+    return exess_bigint_bigit(num, 0) << amount.bits;
   }
 
   // Bigit + sub-bigit bit offset shift
   const unsigned right_shift = BIGINT_BIGIT_BITS - amount.bits;
-  return (num->bigits[index - amount.bigits] << amount.bits) |
-         (num->bigits[index - amount.bigits - 1] >> right_shift);
+  return (exess_bigint_bigit(num, i) << amount.bits) |
+         (exess_bigint_bigit(num, i - 1) >> right_shift);
 }
 
 Bigit
@@ -483,23 +536,38 @@ exess_bigint_subtract_left_shifted(ExessBigint*       lhs,
   assert(exess_bigint_is_clamped(rhs));
 #ifndef NDEBUG
   {
-    ExessBigint check_rhs = *rhs;
+    ExessBigint check_rhs;
+    exess_bigint_set(&check_rhs, rhs);
     exess_bigint_shift_left(&check_rhs, amount);
     assert(exess_bigint_compare(lhs, &check_rhs) >= 0);
   }
 #endif
 
-  const Offset   offset     = make_offset(amount);
-  const unsigned r_n_bigits = rhs->n_bigits + offset.bigits + (bool)offset.bits;
+  // The low bigits of the shifted RHS are zero, so those of the LHS are kept
+  const Offset   offset      = make_offset(amount);
+  const unsigned right_shift = BIGINT_BIGIT_BITS - offset.bits;
 
   bool     borrow = 0;
-  unsigned i      = 0;
-  for (i = 0; i < r_n_bigits; ++i) {
-    const Bigit l = lhs->bigits[i];
-    const Bigit r = exess_bigint_left_shifted_bigit_i(rhs, offset, i);
+  unsigned i      = offset.bigits;
+  Bigit    prev   = 0U;
+  for (unsigned j = 0U; j < rhs->n_bigits; ++j, ++i) {
+    const Bigit next = rhs->bigits[j];
+    const Bigit l    = lhs->bigits[i];
+    const Bigit r =
+      offset.bits ? ((next << offset.bits) | (prev >> right_shift)) : next;
 
     lhs->bigits[i] = l - r - borrow;
     borrow         = l < r || ((l == r) && borrow);
+    prev           = next;
+  }
+
+  // Subtract any bits shifted past the top of the RHS
+  const Bigit top = offset.bits ? (prev >> right_shift) : 0U;
+  if (top) {
+    const Bigit l = lhs->bigits[i];
+
+    lhs->bigits[i++] = l - top - borrow;
+    borrow           = l < top || ((l == top) && borrow);
   }
 
   exess_bigint_subtract_borrow(lhs, i, borrow);
@@ -541,7 +609,7 @@ exess_bigint_divmod(ExessBigint* lhs, const ExessBigint* rhs)
 
     lhs->bigits[lhs->n_bigits - 1] = l0 % r0;
     lhs->n_bigits -= (lhs->bigits[lhs->n_bigits - 1] == 0);
-    return result + (l0 / r0);
+    return result + (uint32_t)(l0 / r0);
   }
 
   // Both now have the same number of digits, finish with subtraction
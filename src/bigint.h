@@ -1,14 +1,25 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_BIGINT_H
 #define EXESS_SRC_BIGINT_H
 
 #include "attributes.h"
+#include "exess_config.h"
 
 #include <stdint.h>
 
+/* Bigits are as wide as possible while still having a native type for the
+   product of two, since that halves the number of bigits and multiplications
+   compared to using 32-bit bigits with 64-bit products. */
+
+#if USE_INT128
+typedef uint64_t Bigit;
+#  define BIGINT_BIGIT_BITS 64U
+#else
 typedef uint32_t Bigit;
+#  define BIGINT_BIGIT_BITS 32U
+#endif
 
 /* We need enough precision for any double, the "largest" of which (using
    absolute exponents) is the smallest subnormal ~= 5e-324.  This is 1076 bits
@@ -17,7 +28,6 @@ typedef uint32_t Bigit;
 */
 
 #define BIGINT_MAX_SIGNIFICANT_BITS 1280U
-#define BIGINT_BIGIT_BITS 32U
 #define BIGINT_MAX_BIGITS (BIGINT_MAX_SIGNIFICANT_BITS / BIGINT_BIGIT_BITS)
 
 typedef struct {
@@ -1,24 +1,26 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "write_utils.h"
 
 #include <exess/exess.h>
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 ExessResult
-exess_read_boolean(bool* const out, const char* const str)
+read_boolean(bool* const out, const size_t len, const char* const str)
 {
-  size_t      i = skip_whitespace(str);
+  size_t      i = skip_whitespace(len, str);
   ExessResult r = {EXESS_EXPECTED_BOOLEAN, i};
 
   *out = false;
 
-  switch (str[i]) {
+  switch (peek(len, str, i)) {
   case '0':
     return result(EXESS_SUCCESS, i + 1);
 
@@ -27,14 +29,14 @@ exess_read_boolean(bool* const out, const char* const str)
     return result(EXESS_SUCCESS, i + 1);
 
   case 't':
-    if (!strncmp(str + i, "true", 4)) {
+    if (len - i >= 4U && !strncmp(str + i, "true", 4)) {
       *out = true;
       return result(EXESS_SUCCESS, i + 4U);
     }
     break;
 
   case 'f':
-    if (!strncmp(str + i, "false", 5)) {
+    if (len - i >= 5U && !strncmp(str + i, "false", 5)) {
       return result(EXESS_SUCCESS, i + 5U);
     }
     break;
@@ -46,6 +48,12 @@ exess_read_boolean(bool* const out, const char* const str)
   return result(r.status, r.count);
 }
 
+ExessResult
+exess_read_boolean(bool* const out, const char* const str)
+{
+  return read_boolean(out, SIZE_MAX, str);
+}
+
 ExessResult
 exess_write_boolean(const bool value, const size_t buf_size, char* const buf)
 {
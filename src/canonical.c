@@ -1,6 +1,7 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
+#include "char_class.h"
 #include "read_utils.h"
 #include "result.h"
 #include "string_utils.h"
@@ -10,6 +11,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 /// Return true iff `c` is "0"
 static inline bool
@@ -36,6 +38,13 @@ scan(bool (*pred)(const int), const char* const str, size_t i)
   return i;
 }
 
+// Scan forwards past any digits
+static inline size_t
+scan_digits_from(const char* const str, const size_t i)
+{
+  return i + scan_digits(SIZE_MAX, str + i);
+}
+
 // Skip the next character if `pred` returns true for it
 static inline size_t
 skip(bool (*pred)(const int), const char* const str, const size_t i)
@@ -46,16 +55,16 @@ skip(bool (*pred)(const int), const char* const str, const size_t i)
 static ExessVariableResult
 write_decimal(const char* const str, const size_t buf_size, char* const buf)
 {
-  const size_t sign    = skip_whitespace(str);     // Sign
-  const size_t leading = skip(is_sign, str, sign); // First digit
+  const size_t sign    = skip_whitespace(SIZE_MAX, str); // Sign
+  const size_t leading = skip(is_sign, str, sign);      // First digit
   if (str[leading] != '.' && !is_digit(str[leading])) {
     return vresult(EXESS_EXPECTED_DIGIT, sign, 0);
   }
 
   const size_t first = scan(is_zero, str, leading); // First non-zero
-  const size_t point = scan(is_digit, str, first);  // Decimal point
+  const size_t point = scan_digits_from(str, first); // Decimal point
   const size_t end =
-    scan(is_digit, str, skip(is_point, str, point)); // Last digit
+    scan_digits_from(str, skip(is_point, str, point)); // Last digit
 
   // Ignore trailing zeros
   size_t last = end;
@@ -103,7 +112,7 @@ write_integer(const ExessDatatype datatype,
               const size_t        buf_size,
               char* const         buf)
 {
-  const size_t sign = skip_whitespace(str); // Sign
+  const size_t sign = skip_whitespace(SIZE_MAX, str); // Sign
 
   if ((str[sign] == '-' && (datatype == EXESS_NON_NEGATIVE_INTEGER ||
                             datatype == EXESS_POSITIVE_INTEGER)) ||
@@ -119,7 +128,7 @@ write_integer(const ExessDatatype datatype,
   }
 
   const size_t first = scan(is_zero, str, leading); // First non-zero
-  const size_t last  = scan(is_digit, str, first);  // Last digit
+  const size_t last  = scan_digits_from(str, first); // Last digit
 
   // Handle zero as a special case (no non-zero digits to copy)
   size_t o = 0;
@@ -169,34 +178,32 @@ write_date_time(const char* const str, const size_t buf_size, char* const buf)
 static ExessVariableResult
 write_hex(const char* const str, const size_t buf_size, char* const buf)
 {
-  size_t i = skip_whitespace(str);
-  size_t o = 0;
+  const size_t first = skip_whitespace(SIZE_MAX, str);
+  const size_t n     = scan_hexdigs(SIZE_MAX, str + first);
+  const size_t o     = write_string(n, str + first, buf_size, buf, 0U);
 
-  for (; str[i]; ++i) {
-    if (is_hexdig(str[i])) {
-      o += write_char(str[i], buf_size, buf, o);
-    } else {
-      break;
-    }
-  }
-
-  return vresult(
-    (o == 0 || o % 2 != 0) ? EXESS_EXPECTED_HEX : EXESS_SUCCESS, i, o);
+  return vresult((o == 0 || o % 2 != 0) ? EXESS_EXPECTED_HEX : EXESS_SUCCESS,
+                 first + n,
+                 o);
 }
 
 static ExessVariableResult
 write_base64(const char* const str, const size_t buf_size, char* const buf)
 {
-  size_t i = 0;
-  size_t o = 0;
-
-  for (; str[i]; ++i) {
-    if (is_base64(str[i])) {
-      o += write_char(str[i], buf_size, buf, o);
-    } else if (!is_space(str[i])) {
-      break;
-    }
-  }
+  size_t i        = 0;
+  size_t o        = 0;
+  size_t n_digits = 0;
+  size_t n_spaces = 0;
+
+  // Copy runs of digits and skip runs of whitespace until something else
+  do {
+    n_digits = scan_base64(SIZE_MAX, str + i);
+    o += write_string(n_digits, str + i, buf_size, buf, o);
+    i += n_digits;
+
+    n_spaces = skip_whitespace(SIZE_MAX, str + i);
+    i += n_spaces;
+  } while (n_digits || n_spaces);
 
   if (o == 0 || o % 4 != 0) {
     return vresult(EXESS_EXPECTED_BASE64, i, o);
@@ -0,0 +1,270 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+/*
+  Scanning for runs of characters in a class.
+
+  A class is described by a scalar predicate, and by a few inclusive ranges
+  of ASCII characters which can be checked many at a time.  Since strings are
+  often null-terminated with an unknown length, they're scanned in windows
+  which are first bounded by searching for the terminator with memchr(), so
+  wide loads never read past the end.  Within a window, whole blocks are
+  checked with SIMD if possible, then whole words with plain integer
+  arithmetic, then any remaining characters one at a time.
+*/
+
+#include "char_class.h"
+
+#include "attributes.h"
+#include "cpu.h"
+#include "exess_config.h"
+#include "macros.h"
+#include "string_utils.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if USE_X86_SIMD
+#  include <immintrin.h>
+#endif
+
+/// Number of characters checked individually before scanning more widely
+#define SHORT_RUN_LENGTH 16U
+
+/// Minimum and maximum number of characters to scan per terminator search
+#define MIN_WINDOW_SIZE 32U
+#define MAX_WINDOW_SIZE 256U
+
+/// Maximum number of ranges in a class
+#define MAX_RANGES 5U
+
+typedef struct {
+  bool (*pred)(int);              ///< Return true if `c` is in the class
+  unsigned n_ranges;              ///< Number of ranges in the class
+  uint8_t  ranges[MAX_RANGES][2]; ///< Inclusive min and max of each range
+} CharClass;
+
+static const CharClass space_class = {
+  is_space, 3U, {{'\t', '\n'}, {'\r', '\r'}, {' ', ' '}}};
+
+static const CharClass digit_class = {is_digit, 1U, {{'0', '9'}}};
+
+static const CharClass hexdig_class = {
+  is_hexdig, 2U, {{'0', '9'}, {'A', 'F'}}};
+
+static const CharClass base64_class = {
+  is_base64,
+  5U,
+  {{'+', '+'}, {'/', '9'}, {'=', '='}, {'A', 'Z'}, {'a', 'z'}}};
+
+#if USE_X86_SIMD
+
+EXESS_I_TARGET("sse2")
+static size_t
+scan_sse2(const CharClass* const cls,
+          const size_t           len,
+          const uint8_t* const   str)
+{
+  // Characters are in a range if they're greater than min-1 and less than max+1
+  __m128i mins[MAX_RANGES];
+  __m128i maxes[MAX_RANGES];
+  for (unsigned r = 0U; r < cls->n_ranges; ++r) {
+    mins[r]  = _mm_set1_epi8((char)(cls->ranges[r][0] - 1U));
+    maxes[r] = _mm_set1_epi8((char)(cls->ranges[r][1] + 1U));
+  }
+
+  size_t i = 0U;
+  for (; len - i >= 16U; i += 16U) {
+    const __m128i in = _mm_loadu_si128((const void*)(str + i));
+
+    __m128i match = _mm_setzero_si128();
+    for (unsigned r = 0U; r < cls->n_ranges; ++r) {
+      const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi8(in, mins[r]),
+                                             _mm_cmpgt_epi8(maxes[r], in));
+
+      match = _mm_or_si128(match, in_range);
+    }
+
+    const unsigned mask = (unsigned)_mm_movemask_epi8(match);
+    if (mask != 0xFFFFU) {
+      return i + (unsigned)__builtin_ctz(~mask);
+    }
+  }
+
+  return i;
+}
+
+EXESS_I_TARGET("avx2")
+static size_t
+scan_avx2(const CharClass* const cls,
+          const size_t           len,
+          const uint8_t* const   str)
+{
+  __m256i mins[MAX_RANGES];
+  __m256i maxes[MAX_RANGES];
+  for (unsigned r = 0U; r < cls->n_ranges; ++r) {
+    mins[r]  = _mm256_set1_epi8((char)(cls->ranges[r][0] - 1U));
+    maxes[r] = _mm256_set1_epi8((char)(cls->ranges[r][1] + 1U));
+  }
+
+  size_t i = 0U;
+  for (; len - i >= 32U; i += 32U) {
+    const __m256i in = _mm256_loadu_si256((const void*)(str + i));
+
+    __m256i match = _mm256_setzero_si256();
+    for (unsigned r = 0U; r < cls->n_ranges; ++r) {
+      const __m256i in_range =
+        _mm256_and_si256(_mm256_cmpgt_epi8(in, mins[r]),
+                         _mm256_cmpgt_epi8(maxes[r], in));
+
+      match = _mm256_or_si256(match, in_range);
+    }
+
+    const unsigned mask = (unsigned)_mm256_movemask_epi8(match);
+    if (mask != 0xFFFFFFFFU) {
+      return i + (unsigned)__builtin_ctz(~mask);
+    }
+  }
+
+  return i;
+}
+
+static size_t
+scan_simd(const CharClass* const cls, const size_t len, const char* const str)
+{
+  const uint8_t* const ustr = (const uint8_t*)str;
+  size_t               i    = 0U;
+
+  if (cpu_supports(CPU_AVX2)) {
+    i = scan_avx2(cls, len, ustr);
+  }
+
+  if (cpu_supports(CPU_SSE2)) {
+    i += scan_sse2(cls, len - i, ustr + i);
+  }
+
+  return i;
+}
+
+#else
+
+static size_t
+scan_simd(const CharClass* const cls, const size_t len, const char* const str)
+{
+  (void)cls;
+  (void)len;
+  (void)str;
+  return 0U;
+}
+
+#endif // USE_X86_SIMD
+
+// Scan whole 8-byte words, and return the length of those entirely in the class
+static size_t
+scan_words(const CharClass* const cls, const size_t len, const char* const str)
+{
+  static const uint64_t ones  = 0x0101010101010101U;
+  static const uint64_t highs = 0x8080808080808080U;
+
+  size_t i = 0U;
+  for (; len - i >= 8U; i += 8U) {
+    uint64_t word = 0U;
+    memcpy(&word, str + i, sizeof(word));
+
+    /* For the low 7 bits of each byte, adding 0x80 - min sets the high bit if
+       it's at least min, and adding 0x7F - max sets it if it's more than max.
+       Neither addition can carry into the next byte. */
+    const uint64_t low = word & ~highs;
+
+    uint64_t match = 0U;
+    for (unsigned r = 0U; r < cls->n_ranges; ++r) {
+      const uint64_t min = cls->ranges[r][0];
+      const uint64_t max = cls->ranges[r][1];
+
+      match |= (low + (ones * (0x80U - min))) & ~(low + (ones * (0x7FU - max)));
+    }
+
+    // Bytes with the high bit set aren't ASCII, so are never in the class
+    if ((match & ~word & highs) != highs) {
+      break;
+    }
+  }
+
+  return i;
+}
+
+// Scan a string that's known to contain at least `len` characters
+static size_t
+scan_window(const CharClass* const cls, const size_t len, const char* const str)
+{
+  size_t i = scan_simd(cls, len, str);
+
+  i += scan_words(cls, len - i, str + i);
+  while (i < len && cls->pred(str[i])) {
+    ++i;
+  }
+
+  return i;
+}
+
+// Scan from after a run of short length
+static size_t
+scan_rest(const CharClass* const cls, const size_t len, const char* const str)
+{
+  // Search for the terminator in small windows that grow as the run does
+  size_t i      = 0U;
+  size_t window = MIN_WINDOW_SIZE;
+  while (i < len) {
+    const size_t      max = MIN(len - i, window);
+    const char* const end = (const char*)memchr(str + i, '\0', max);
+    const size_t      n   = end ? (size_t)(end - (str + i)) : max;
+    const size_t      run = scan_window(cls, n, str + i);
+
+    i += run;
+    if (run < n || end) {
+      break;
+    }
+
+    window = MIN(window * 2U, MAX_WINDOW_SIZE);
+  }
+
+  return i;
+}
+
+// Scan a run of characters in a class, checking the first few individually
+static inline size_t
+scan_class(const CharClass* const cls, const size_t len, const char* const str)
+{
+  size_t i = 0U;
+  while (i < len && i < SHORT_RUN_LENGTH && cls->pred(str[i])) {
+    ++i;
+  }
+
+  return (i < SHORT_RUN_LENGTH) ? i : (i + scan_rest(cls, len - i, str + i));
+}
+
+size_t
+scan_spaces(const size_t len, const char* const str)
+{
+  return scan_class(&space_class, len, str);
+}
+
+size_t
+scan_digits(const size_t len, const char* const str)
+{
+  return scan_class(&digit_class, len, str);
+}
+
+size_t
+scan_hexdigs(const size_t len, const char* const str)
+{
+  return scan_class(&hexdig_class, len, str);
+}
+
+size_t
+scan_base64(const size_t len, const char* const str)
+{
+  return scan_class(&base64_class, len, str);
+}
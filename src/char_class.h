@@ -0,0 +1,35 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_CHAR_CLASS_H
+#define EXESS_SRC_CHAR_CLASS_H
+
+#include "attributes.h"
+
+#include <stddef.h>
+
+/*
+  Functions to find the length of the run of characters in a class at the
+  start of a string.
+
+  These check many characters at once, but never read past `len` characters
+  or a null terminator, so `len` may be larger than the string.
+*/
+
+/// Return the number of leading whitespace characters in `str`
+EXESS_I_PURE_FUNC size_t
+scan_spaces(size_t len, const char* str);
+
+/// Return the number of leading decimal digits in `str`
+EXESS_I_PURE_FUNC size_t
+scan_digits(size_t len, const char* str);
+
+/// Return the number of leading (uppercase) hex digits in `str`
+EXESS_I_PURE_FUNC size_t
+scan_hexdigs(size_t len, const char* str);
+
+/// Return the number of leading base64 characters (including "=") in `str`
+EXESS_I_PURE_FUNC size_t
+scan_base64(size_t len, const char* str);
+
+#endif // EXESS_SRC_CHAR_CLASS_H
@@ -0,0 +1,107 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+/*
+  Detection of CPU features for choosing SIMD kernels at run time.
+
+  Features are detected with cpuid, and those that use wider registers are
+  only considered supported if the OS saves those registers (as reported by
+  xgetbv), since otherwise using them would crash.  The result is cached,
+  with a flag bit to distinguish it from a CPU that supports nothing.
+  Threads may race to detect features the first time, but will all store
+  the same value, so this is safe with relaxed atomics.
+*/
+
+#include "cpu.h"
+
+#include "exess_config.h"
+
+#if USE_X86_SIMD
+
+#  include <cpuid.h>
+
+/// Flag set in the cached features once they have been detected
+#  define DETECTED (1U << 31U)
+
+// Bits of registers returned by cpuid leaf 1
+#  define LEAF1_EDX_SSE2 (1U << 26U)
+#  define LEAF1_ECX_SSE41 (1U << 19U)
+#  define LEAF1_ECX_OSXSAVE (1U << 27U)
+#  define LEAF1_ECX_AVX (1U << 28U)
+
+// Bits of registers returned by cpuid leaf 7, sub-leaf 0
+#  define LEAF7_EBX_AVX2 (1U << 5U)
+#  define LEAF7_EBX_AVX512F (1U << 16U)
+#  define LEAF7_EBX_AVX512BW (1U << 30U)
+#  define LEAF7_ECX_AVX512VBMI (1U << 1U)
+
+// Register states enabled by the OS in XCR0
+#  define XCR0_YMM 0x06U // XMM and YMM
+#  define XCR0_ZMM 0xE6U // XMM, YMM, opmask, and the upper and high 16 ZMM
+
+static unsigned
+read_xcr0(void)
+{
+  unsigned eax = 0U;
+  unsigned edx = 0U;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0U));
+  (void)edx;
+  return eax;
+}
+
+static unsigned
+detect_features(void)
+{
+  unsigned eax = 0U;
+  unsigned ebx = 0U;
+  unsigned ecx = 0U;
+  unsigned edx = 0U;
+  if (!__get_cpuid(1U, &eax, &ebx, &ecx, &edx)) {
+    return 0U;
+  }
+
+  unsigned features = 0U;
+  features |= (edx & LEAF1_EDX_SSE2) ? CPU_SSE2 : 0U;
+  features |= (ecx & LEAF1_ECX_SSE41) ? CPU_SSE41 : 0U;
+
+  // Wider registers are only usable if the OS saves them
+  const unsigned avx_bits = LEAF1_ECX_OSXSAVE | LEAF1_ECX_AVX;
+  const unsigned xcr0     = ((ecx & avx_bits) == avx_bits) ? read_xcr0() : 0U;
+  const int      has_ymm  = (xcr0 & XCR0_YMM) == XCR0_YMM;
+  const int      has_zmm  = (xcr0 & XCR0_ZMM) == XCR0_ZMM;
+
+  if (has_ymm && __get_cpuid_count(7U, 0U, &eax, &ebx, &ecx, &edx)) {
+    features |= (ebx & LEAF7_EBX_AVX2) ? CPU_AVX2 : 0U;
+
+    if (has_zmm && (ebx & LEAF7_EBX_AVX512F)) {
+      features |= (ebx & LEAF7_EBX_AVX512BW) ? CPU_AVX512BW : 0U;
+      features |= (ecx & LEAF7_ECX_AVX512VBMI) ? CPU_AVX512VBMI : 0U;
+    }
+  }
+
+  return features;
+}
+
+unsigned
+cpu_features(void)
+{
+  static unsigned cached = 0U;
+
+  unsigned features = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+  if (!(features & DETECTED)) {
+    features = detect_features() | DETECTED;
+    __atomic_store_n(&cached, features, __ATOMIC_RELAXED);
+  }
+
+  return features & ~DETECTED;
+}
+
+#else
+
+unsigned
+cpu_features(void)
+{
+  return 0U;
+}
+
+#endif // USE_X86_SIMD
@@ -0,0 +1,42 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_CPU_H
+#define EXESS_SRC_CPU_H
+
+#include <stdbool.h>
+
+/**
+   Instruction set extensions that SIMD kernels may require.
+
+   Extensions that use wider registers are only included if the OS supports
+   them as well.
+*/
+typedef enum {
+  CPU_SSE2       = 1U << 0U, ///< SSE2
+  CPU_SSE41      = 1U << 1U, ///< SSE4.1
+  CPU_AVX2       = 1U << 2U, ///< AVX2
+  CPU_AVX512BW   = 1U << 3U, ///< AVX-512 byte and word instructions
+  CPU_AVX512VBMI = 1U << 4U, ///< AVX-512 vector byte manipulation instructions
+} CpuFeature;
+
+/**
+   Return the features supported by the running CPU.
+
+   This detects features the first time it's called, then returns the same
+   result quickly, so it can be checked every time a kernel is chosen.
+
+   @return A bitwise OR of #CpuFeature flags, which is zero if SIMD support
+   is disabled.
+*/
+unsigned
+cpu_features(void);
+
+/// Return true if the running CPU supports all the given features
+static inline bool
+cpu_supports(const unsigned features)
+{
+  return (cpu_features() & features) == features;
+}
+
+#endif // EXESS_SRC_CPU_H
@@ -1,8 +1,9 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "date_utils.h"
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "timezone.h"
 #include "write_utils.h"
@@ -10,6 +11,7 @@
 
 #include <exess/exess.h>
 
+#include <stdint.h>
 #include <string.h>
 
 ExessOrder
@@ -25,25 +27,31 @@ exess_compare_date(const ExessDate lhs, const ExessDate rhs)
 }
 
 ExessResult
-exess_read_date(ExessDate* const out, const char* const str)
+read_date(ExessDate* const out, const size_t len, const char* const str)
 {
   memset(out, 0, sizeof(*out));
 
   // Read YYYY-MM-DD numbers
-  size_t      i = skip_whitespace(str);
-  ExessResult r = read_date_numbers(out, str + i);
+  size_t      i = skip_whitespace(len, str);
+  ExessResult r = read_date_numbers(out, len - i, str + i);
 
   i += r.count;
 
   // Read timezone if present
   if (!r.status) {
-    r = read_optional_timezone(&out->zone, str + i);
+    r = read_optional_timezone(&out->zone, len - i, str + i);
     i += r.count;
   }
 
   return result(r.status, i);
 }
 
+ExessResult
+exess_read_date(ExessDate* const out, const char* const str)
+{
+  return read_date(out, SIZE_MAX, str);
+}
+
 ExessResult
 exess_write_date(const ExessDate value, const size_t buf_size, char* const buf)
 {
@@ -51,18 +59,26 @@ exess_write_date(const ExessDate value, const size_t buf_size, char* const buf)
     return end_write(EXESS_BAD_VALUE, buf_size, buf, 0);
   }
 
-  ExessResult r = write_year_number(value.year, buf_size, buf);
-  size_t      o = r.count;
-  if (r.status) {
-    return end_write(r.status, buf_size, buf, o);
+  size_t o = 0U;
+  if (buf && value.year >= 0 && value.year <= 9999 &&
+      buf_size >= FIXED_DATE_LENGTH) {
+    // Write the common 4-digit year case all at once
+    write_fixed_date(value, buf);
+    o = FIXED_DATE_LENGTH;
+  } else {
+    const ExessResult yr = write_year_number(value.year, buf_size, buf);
+    if (yr.status) {
+      return end_write(yr.status, buf_size, buf, yr.count);
+    }
+
+    o = yr.count;
+    o += write_char('-', buf_size, buf, o);
+    o += write_two_digit_number(value.month, buf_size, buf, o);
+    o += write_char('-', buf_size, buf, o);
+    o += write_two_digit_number(value.day, buf_size, buf, o);
   }
 
-  o += write_char('-', buf_size, buf, o);
-  o += write_two_digit_number(value.month, buf_size, buf, o);
-  o += write_char('-', buf_size, buf, o);
-  o += write_two_digit_number(value.day, buf_size, buf, o);
-
-  r = write_timezone(value.zone, buf_size, buf, o);
+  const ExessResult r = write_timezone(value.zone, buf_size, buf, o);
 
   return end_write(r.status, buf_size, buf, o + r.count);
 }
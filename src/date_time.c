@@ -1,17 +1,24 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "date_utils.h"
+#include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "string_utils.h"
 #include "time_utils.h"
+#include "timezone.h"
 #include "write_utils.h"
 
 #include <exess/exess.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
+static const int32_t giga            = 1000000000;
+static const int32_t seconds_per_day = 24 * 60 * 60;
+
 static inline ExessDateTime
 infinite_future(const ExessTimezone zone)
 {
@@ -58,21 +65,13 @@ compare_field(const unsigned lhs, const unsigned rhs)
 static ExessOrder
 compare_date_time_total(const ExessDateTime lhs, const ExessDateTime rhs)
 {
-  if (lhs.year != rhs.year) {
-    return lhs.year < rhs.year ? EXESS_ORDER_STRICTLY_LESS
-                               : EXESS_ORDER_STRICTLY_GREATER;
-  }
-
-  const ExessDateTime lhz = exess_date_time_to_utc(lhs);
-  const ExessDateTime rhz = exess_date_time_to_utc(rhs);
-  ExessOrder          cmp = compare_field(lhz.month, rhz.month);
+  const ExessEpochTime lhe = exess_date_time_to_epoch(lhs);
+  const ExessEpochTime rhe = exess_date_time_to_epoch(rhs);
 
-  cmp = cmp ? cmp : compare_field(lhz.day, rhz.day);
-  cmp = cmp ? cmp : compare_field(lhz.hour, rhz.hour);
-  cmp = cmp ? cmp : compare_field(lhz.minute, rhz.minute);
-  cmp = cmp ? cmp : compare_field(lhz.second, rhz.second);
-  cmp = cmp ? cmp : compare_field(lhz.nanosecond, rhz.nanosecond);
-  return cmp;
+  return (lhe.seconds < rhe.seconds)   ? EXESS_ORDER_STRICTLY_LESS
+         : (lhe.seconds > rhe.seconds) ? EXESS_ORDER_STRICTLY_GREATER
+                                       : compare_field(lhe.nanoseconds,
+                                                       rhe.nanoseconds);
 }
 
 static ExessDateTime
@@ -90,6 +89,77 @@ exess_date_time_to_utc(const ExessDateTime datetime)
   return to_utc(datetime, offset);
 }
 
+ExessEpochTime
+exess_date_time_to_epoch(const ExessDateTime datetime)
+{
+  // Map the infinite past and future to the extremes (see infinite_past())
+  if (datetime.month < 1U || datetime.month > 12U) {
+    const ExessEpochTime infinity = {
+      datetime.month ? INT64_MAX : INT64_MIN,
+      datetime.month ? (uint32_t)(giga - 1) : 0U,
+    };
+
+    return infinity;
+  }
+
+  const int64_t days =
+    days_from_civil(datetime.year, datetime.month, datetime.day);
+
+  const int64_t time =
+    (((datetime.hour * 60) + datetime.minute) * 60) + datetime.second;
+
+  const int64_t offset =
+    (datetime.zone == EXESS_LOCAL) ? 0 : (datetime.zone * 15 * 60);
+
+  const ExessEpochTime r = {(days * seconds_per_day) + time - offset,
+                            datetime.nanosecond};
+  return r;
+}
+
+ExessDateTime
+exess_date_time_from_epoch(const ExessEpochTime time, const ExessTimezone zone)
+{
+  static const int64_t max_seconds = INT64_C(1) << 48U; // Over INT16_MAX years
+
+  // Check the range before doing anything that could overflow
+  if (time.seconds > max_seconds) {
+    return infinite_future(zone);
+  }
+
+  if (time.seconds < -max_seconds) {
+    return infinite_past(zone);
+  }
+
+  // Carry nanoseconds into seconds, and add the timezone offset
+  const uint32_t giga_u      = (uint32_t)giga;
+  const uint32_t nanoseconds = time.nanoseconds % giga_u;
+  const int64_t  seconds     = time.seconds + (time.nanoseconds / giga_u) +
+                          ((zone == EXESS_LOCAL) ? 0 : (zone * 15 * 60));
+
+  // Split into days and seconds of the day (both rounding down)
+  const int64_t day_seconds =
+    ((seconds % seconds_per_day) + seconds_per_day) % seconds_per_day;
+  const int64_t days = (seconds - day_seconds) / seconds_per_day;
+
+  ExessDateTime r    = {0, 0U, 0U, zone, 0U, 0U, 0U, 0U};
+  int64_t       year = 0;
+  civil_from_days(days, &year, &r.month, &r.day);
+  if (year > INT16_MAX) {
+    return infinite_future(zone);
+  }
+
+  if (year < INT16_MIN) {
+    return infinite_past(zone);
+  }
+
+  r.year       = (int16_t)year;
+  r.hour       = (uint8_t)(day_seconds / (60 * 60));
+  r.minute     = (uint8_t)(day_seconds / 60 % 60);
+  r.second     = (uint8_t)(day_seconds % 60);
+  r.nanosecond = nanoseconds;
+  return r;
+}
+
 static ExessOrder
 compare_date_time_partial(const ExessDateTime lhs, const ExessDateTime rhs)
 {
@@ -164,33 +234,27 @@ add_field(const int32_t  lhs,
    This might return the infinite past or future.
 */
 EXESS_CONST_FUNC static ExessDateTime
-carry_set_day(ExessDateTime e, int day)
+carry_set_day(ExessDateTime e, const int32_t day)
 {
-  while (day < 1 || day > days_in_month(e.year, e.month)) {
-    if (day < 1) {
-      if (--e.month == 0) {
-        if (e.year == INT16_MIN) {
-          return infinite_past(e.zone);
-        }
-
-        --e.year;
-        e.month = 12;
-      }
-      day += days_in_month(e.year, e.month);
-    } else {
-      day -= days_in_month(e.year, e.month);
-      if (++e.month > 12) {
-        if (e.year == INT16_MAX) {
-          return infinite_future(e.zone);
-        }
-
-        ++e.year;
-        e.month = (uint8_t)modulo(e.month, 1, 13);
-      }
-    }
+  if (day >= 1 && day <= days_in_month(e.year, e.month)) {
+    e.day = (uint8_t)day; // Common case: no carry
+    return e;
   }
 
-  e.day = (uint8_t)day;
+  // Convert to a day number and back to normalize in constant time
+  int64_t year = 0;
+  civil_from_days(
+    days_from_civil(e.year, e.month, day), &year, &e.month, &e.day);
+
+  if (year > INT16_MAX) {
+    return infinite_future(e.zone);
+  }
+
+  if (year < INT16_MIN) {
+    return infinite_past(e.zone);
+  }
+
+  e.year = (int16_t)year;
   return e;
 }
 
@@ -201,11 +265,9 @@ exess_add_date_time_duration(const ExessDateTime s, const ExessDuration d)
   // and https://www.w3.org/TR/xmlschema11-2/#sec-dt-arith
   // This algorithm is modified here to support subtraction when d is negative
 
-  static const int32_t giga = 1000000000;
-
   const int32_t d_year   = d.months / 12;
   const int32_t d_month  = d.months % 12;
-  const int32_t d_day    = d.seconds / (24 * 60 * 60);
+  const int32_t d_day    = d.seconds / seconds_per_day;
   const int32_t d_hour   = d.seconds / 60 / 60 % 24;
   const int32_t d_minute = d.seconds / 60 % 60;
   const int32_t d_second = d.seconds % 60;
@@ -249,14 +311,118 @@ exess_add_date_time_duration(const ExessDateTime s, const ExessDuration d)
   return carry_set_day(e, s.day + d_day + carry);
 }
 
+// Load 8 characters into a word with the first in the least significant byte
+static inline uint64_t
+load_chars(const char* const str)
+{
+  uint64_t word = 0U;
+  for (unsigned i = 0U; i < 8U; ++i) {
+    word |= (uint64_t)(uint8_t)str[i] << (8U * i);
+  }
+
+  return word;
+}
+
+// Return true if `word` has digits where `digits` is set and `seps` elsewhere
+static inline bool
+matches_layout(const uint64_t word, const uint64_t digits, const uint64_t seps)
+{
+  static const uint64_t highs = 0xF0F0F0F0F0F0F0F0U;
+
+  // Replace separators with '0', then check that the high nibble of every
+  // byte is 3, and that it still is after adding 6 (so the digit is <= 9)
+  const uint64_t v = (word & digits) | (0x3030303030303030U & ~digits);
+  const uint64_t h = (v & highs) | (((v + 0x0606060606060606U) & highs) >> 4U);
+
+  return (word & ~digits) == seps && h == 0x3333333333333333U;
+}
+
+static inline uint8_t
+two_digits(const char* const str)
+{
+  return (uint8_t)(((str[0] - '0') * 10) + (str[1] - '0'));
+}
+
+/*
+  Read the common fixed layout "YYYY-MM-DDTHH:MM:SS" quickly.
+
+  This checks the whole layout with three overlapping 8-character loads, and
+  only succeeds if all fields are valid and in range.  Anything else,
+  including midnight as 24:00:00, is left to the general parser, which will
+  produce the same result or error.
+*/
+static bool
+read_fixed_date_time(ExessDateTime* const out, const char* const str)
+{
+  // Masks of digit positions, and separator values, of each 8 characters
+  static const uint64_t date_digits = 0x00FFFF00FFFFFFFFU; // "YYYY-MM-"
+  static const uint64_t date_seps   = 0x2D00002D00000000U;
+  static const uint64_t mid_digits  = 0xFFFF00FFFF00FFFFU; // "DDTHH:MM"
+  static const uint64_t mid_seps    = 0x00003A0000540000U;
+  static const uint64_t time_digits = 0xFFFF00FFFF00FFFFU; // "HH:MM:SS"
+  static const uint64_t time_seps   = 0x00003A00003A0000U;
+
+  if (!matches_layout(load_chars(str), date_digits, date_seps) ||
+      !matches_layout(load_chars(str + 8), mid_digits, mid_seps) ||
+      !matches_layout(load_chars(str + 11), time_digits, time_seps)) {
+    return false;
+  }
+
+  const int16_t year =
+    (int16_t)((two_digits(str) * 100) + two_digits(str + 2));
+  const uint8_t month = two_digits(str + 5);
+  const uint8_t day   = two_digits(str + 8);
+  const uint8_t hour  = two_digits(str + 11);
+  const uint8_t min   = two_digits(str + 14);
+  const uint8_t sec   = two_digits(str + 17);
+  if (month < 1U || month > 12U || day < 1U ||
+      day > days_in_month(year, month) || hour > 23U || min > 59U ||
+      sec > 59U) {
+    return false;
+  }
+
+  out->year   = year;
+  out->month  = month;
+  out->day    = day;
+  out->hour   = hour;
+  out->minute = min;
+  out->second = sec;
+  return true;
+}
+
 ExessResult
-exess_read_date_time(ExessDateTime* const out, const char* const str)
+read_date_time(ExessDateTime* const out,
+               const size_t         len,
+               const char* const    str)
 {
   memset(out, 0, sizeof(*out));
 
+  // Try to read the common fixed layout quickly if there's enough input
+  const size_t first = skip_whitespace(len, str);
+  if (len - first >= 19U && !memchr(str + first, '\0', 19U) &&
+      read_fixed_date_time(out, str + first)) {
+    size_t      i = first + 19U;
+    ExessResult r = {EXESS_SUCCESS, 0U};
+
+    // Read nanoseconds if present
+    out->zone = EXESS_LOCAL;
+    if (peek(len, str, i) == '.') {
+      ++i;
+      r = read_nanoseconds(&out->nanosecond, len - i, str + i);
+      i += r.count;
+      if (r.status) {
+        return result(r.status, i);
+      }
+    }
+
+    // Read timezone offset if present
+    r = read_optional_timezone(&out->zone, len - i, str + i);
+    return result(r.status, i + r.count);
+  }
+
   // Read date
   ExessDate         date = {0, 0U, 0U, EXESS_LOCAL};
-  const ExessResult dr   = read_date_numbers(&date, str);
+  const ExessResult dr   = read_date_numbers(&date, len, str);
 
   out->year  = date.year;
   out->month = date.month;
@@ -266,7 +432,7 @@ exess_read_date_time(ExessDateTime* const out, const char* const str)
   }
 
   size_t i = dr.count;
-  if (str[i] != 'T') {
+  if (peek(len, str, i) != 'T') {
     return result(EXESS_EXPECTED_TIME_SEP, i);
   }
 
@@ -274,7 +440,7 @@ exess_read_date_time(ExessDateTime* const out, const char* const str)
 
   // Read time
   ExessTime         time = {EXESS_LOCAL, 0U, 0U, 0U, 0U};
-  const ExessResult tr   = read_time(&time, str + i);
+  const ExessResult tr   = read_time_numbers(&time, len - i, str + i);
 
   out->zone       = time.zone;
   out->hour       = time.hour;
@@ -289,6 +455,12 @@ exess_read_date_time(ExessDateTime* const out, const char* const str)
   return result(EXESS_SUCCESS, i);
 }
 
+ExessResult
+exess_read_date_time(ExessDateTime* const out, const char* const str)
+{
+  return read_date_time(out, SIZE_MAX, str);
+}
+
 ExessResult
 exess_write_date_time(const ExessDateTime value,
                       const size_t        buf_size,
@@ -307,6 +479,21 @@ exess_write_date_time(const ExessDateTime value,
     return end_write(EXESS_BAD_VALUE, buf_size, buf, 0);
   }
 
+  // Write the common 4-digit year case with fixed-width fields in one pass
+  if (buf && value.year >= 0 && value.year <= 9999 &&
+      buf_size >= FIXED_DATE_LENGTH + 1U + FIXED_TIME_LENGTH) {
+    write_fixed_date(date, buf);
+    buf[FIXED_DATE_LENGTH] = 'T';
+    write_fixed_time(time, buf + FIXED_DATE_LENGTH + 1U);
+
+    size_t o = FIXED_DATE_LENGTH + 1U + FIXED_TIME_LENGTH;
+    o += write_nanoseconds(value.nanosecond, buf_size, buf, o);
+
+    const ExessResult zr = write_timezone(value.zone, buf_size, buf, o);
+
+    return end_write(zr.status, buf_size, buf, o + zr.count);
+  }
+
   // Write date
   ExessResult dr = exess_write_date(date, buf_size, buf);
   if (dr.status) {
@@ -1,4 +1,4 @@
-// Copyright 2019-2023 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "date_utils.h"
@@ -11,37 +11,37 @@
 #include <stddef.h>
 
 ExessResult
-read_date_numbers(ExessDate* const out, const char* const str)
+read_date_numbers(ExessDate* const out, const size_t len, const char* const str)
 {
   // Read year at the beginning
-  size_t      i = skip_whitespace(str);
-  ExessResult r = read_year_number(&out->year, str + i);
+  size_t      i = skip_whitespace(len, str);
+  ExessResult r = read_year_number(&out->year, len - i, str + i);
   if (r.status) {
     return result(r.status, i + r.count);
   }
 
   // Read year-month delimiter
   i += r.count;
-  if (str[i] != '-') {
+  if (peek(len, str, i) != '-') {
     return result(EXESS_EXPECTED_DASH, i);
   }
 
   // Read month
   ++i;
-  r = read_two_digit_number(&out->month, 1, 12, str + i);
+  r = read_two_digit_number(&out->month, 1, 12, len - i, str + i);
   if (r.status) {
     return result(r.status, i + r.count);
   }
 
   // Read month-day delimiter
   i += r.count;
-  if (str[i] != '-') {
+  if (peek(len, str, i) != '-') {
     return result(EXESS_EXPECTED_DASH, i);
   }
 
   // Read day
   ++i;
-  r = read_two_digit_number(&out->day, 1, 31, str + i);
+  r = read_two_digit_number(&out->day, 1, 31, len - i, str + i);
   if (r.status) {
     return result(r.status, i + r.count);
   }
@@ -1,13 +1,17 @@
-// Copyright 2019-2024 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_DATE_UTILS_H
 #define EXESS_SRC_DATE_UTILS_H
 
+#include "write_utils.h"
+
 #include <exess/exess.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 /// Return whether a year is a leap year in the proleptic Gregorian calendar
 static inline bool
@@ -24,8 +28,76 @@ days_in_month(const int16_t year, const uint8_t month)
                      : (uint8_t)(30U + ((month + (month / 8U)) % 2U));
 }
 
+/**
+   Return the number of days since 1970-01-01 in the proleptic Gregorian
+   calendar.
+
+   See <https://howardhinnant.github.io/date_algorithms.html#days_from_civil>.
+   This works for any valid date, and any day past the end of the month.
+*/
+static inline int64_t
+days_from_civil(const int64_t year, const unsigned month, const int64_t day)
+{
+  const int64_t  y   = year - (month <= 2U);
+  const int64_t  era = (y >= 0 ? y : y - 399) / 400;
+  const uint64_t yoe = (uint64_t)(y - (era * 400)); // [0, 399]
+  const uint64_t mp  = (month + 9U) % 12U;          // March is 0
+  const uint64_t doy = (((153U * mp) + 2U) / 5U);   // [0, 365]
+  const uint64_t doe = (yoe * 365U) + (yoe / 4U) - (yoe / 100U) + doy;
+
+  return (era * 146097) + (int64_t)doe - 719468 + (day - 1);
+}
+
+/**
+   Set a date from a number of days since 1970-01-01.
+
+   This is the inverse of days_from_civil(), see
+   <https://howardhinnant.github.io/date_algorithms.html#civil_from_days>.
+*/
+static inline void
+civil_from_days(const int64_t  days,
+                int64_t* const year,
+                uint8_t* const month,
+                uint8_t* const day)
+{
+  const int64_t  z   = days + 719468;
+  const int64_t  era = (z >= 0 ? z : z - 146096) / 146097;
+  const uint64_t doe = (uint64_t)(z - (era * 146097)); // [0, 146096]
+  const uint64_t yoe =
+    (doe - (doe / 1460U) + (doe / 36524U) - (doe / 146096U)) / 365U;
+  const uint64_t doy = doe - ((365U * yoe) + (yoe / 4U) - (yoe / 100U));
+  const uint64_t mp  = ((5U * doy) + 2U) / 153U; // March is 0
+
+  *day   = (uint8_t)(doy - (((153U * mp) + 2U) / 5U) + 1U);
+  *month = (uint8_t)(mp < 10U ? mp + 3U : mp - 9U);
+  *year  = (int64_t)yoe + (era * 400) + (*month <= 2U);
+}
+
+/// Length of a date with a 4-digit year and no timezone, like YYYY-MM-DD
+#define FIXED_DATE_LENGTH 10U
+
+/**
+   Write a date with a 4-digit year and no timezone, like YYYY-MM-DD.
+
+   The year must be from 0 to 9999, and `buf` must have space for
+   #FIXED_DATE_LENGTH characters.  No terminating null is written.
+*/
+static inline void
+write_fixed_date(const ExessDate value, char* const buf)
+{
+  const unsigned year = (unsigned)value.year;
+
+  char chars[FIXED_DATE_LENGTH] = {'0', '0', '0', '0', '-', '0', '0', '-'};
+  copy_digit_pair(chars, year / 100U);
+  copy_digit_pair(chars + 2U, year % 100U);
+  copy_digit_pair(chars + 5U, value.month);
+  copy_digit_pair(chars + 8U, value.day);
+
+  memcpy(buf, chars, sizeof(chars));
+}
+
 /// Read YYYY-MM-DD date numbers without a timezone
 ExessResult
-read_date_numbers(ExessDate* out, const char* str);
+read_date_numbers(ExessDate* out, size_t len, const char* str);
 
 #endif // EXESS_SRC_DATE_UTILS_H
@@ -1,8 +1,9 @@
-// Copyright 2019-2024 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "floating_decimal.h"
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "strtod.h"
 #include "write_utils.h"
@@ -13,6 +14,7 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 typedef enum {
@@ -87,13 +89,13 @@ set_zeros(char* const dest, const size_t n)
 }
 
 ExessResult
-exess_read_decimal(double* const out, const char* const str)
+read_decimal(double* const out, const size_t len, const char* const str)
 {
   *out = (double)NAN;
 
-  const size_t         i  = skip_whitespace(str);
+  const size_t         i  = skip_whitespace(len, str);
   ExessFloatingDecimal in = {EXESS_NAN, 0U, 0, {0}};
-  const ExessResult    r  = parse_decimal(&in, str + i);
+  const ExessResult    r  = parse_decimal(&in, len - i, str + i);
   if (!r.status) {
     *out = decimal_to_double(in);
   }
@@ -101,6 +103,12 @@ exess_read_decimal(double* const out, const char* const str)
   return result(r.status, i + r.count);
 }
 
+ExessResult
+exess_read_decimal(double* const out, const char* const str)
+{
+  return read_decimal(out, SIZE_MAX, str);
+}
+
 ExessResult
 exess_write_decimal(const double value, const size_t buf_size, char* const buf)
 {
@@ -1,4 +1,4 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "digits.h"
@@ -24,12 +24,10 @@
   generate decimal digits.
 
   Unfortunately, this algorithm requires pretty massive bigints to work
-  correctly for all doubles, and isn't particularly fast.  Something like
-  Grisu3 could be added to improve performance, but that has the annoying
-  property of needing a more precise fallback in some cases, meaning it would
-  only add more code, not replace any.  Since this is already a pretty
-  ridiculous amount of code, I'll hold off on this until it becomes a problem,
-  or somebody comes up with a better algorithm.
+  correctly for all doubles, and isn't particularly fast.  So, shortest double
+  digits are generated with the much faster generate_shortest_digits() in
+  shortest.c, and this is only used for a limited number of digits, and as a
+  (slow but simple) reference that the fast path is tested against.
 */
 
 /// Return true if the number is within the lower boundary
@@ -122,7 +120,8 @@ check_initial_values(const ExessBigint* const numer,
                      const ExessBigint* const denom,
                      const ExessBigint* const d_upper)
 {
-  ExessBigint upper = *numer;
+  ExessBigint upper;
+  exess_bigint_set(&upper, numer);
   exess_bigint_add(&upper, d_upper);
   assert(exess_bigint_compare(&upper, denom) >= 0);
 
@@ -227,8 +226,8 @@ generate_digits(const double d, const unsigned max_digits, char* const buf)
   if (lower_is_closer) {
     // Scale upper boundary to account for the closer lower boundary
     // (the numerator and denominator were already scaled above)
-    d_upper_storage = d_lower;
-    d_upper         = &d_upper_storage;
+    exess_bigint_set(&d_upper_storage, &d_lower);
+    d_upper = &d_upper_storage;
     exess_bigint_shift_left(d_upper, 1);
   } else {
     d_upper = &d_lower; // Boundaries are the same, reuse the lower
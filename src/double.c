@@ -1,8 +1,9 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "floating_decimal.h"
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "scientific.h"
 #include "strtod.h"
@@ -11,16 +12,17 @@
 #include <exess/exess.h>
 
 #include <math.h>
+#include <stdint.h>
 #include <string.h>
 
 ExessResult
-exess_read_double(double* const out, const char* const str)
+read_double(double* const out, const size_t len, const char* const str)
 {
   *out = (double)NAN;
 
-  const size_t         i  = skip_whitespace(str);
+  const size_t         i  = skip_whitespace(len, str);
   ExessFloatingDecimal in = {EXESS_NAN, 0U, 0, {0}};
-  const ExessResult    r  = parse_double(&in, str + i);
+  const ExessResult    r  = parse_double(&in, len - i, str + i);
 
   if (!r.status) {
     *out = decimal_to_double(in);
@@ -29,6 +31,12 @@ exess_read_double(double* const out, const char* const str)
   return result(r.status, i + r.count);
 }
 
+ExessResult
+exess_read_double(double* const out, const char* const str)
+{
+  return read_double(out, SIZE_MAX, str);
+}
+
 ExessResult
 exess_write_double(const double value, const size_t buf_size, char* const buf)
 {
@@ -1,7 +1,11 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
+#include "duration.h"
+
+#include "date_utils.h"
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "string_utils.h"
 #include "time_utils.h"
@@ -46,16 +50,18 @@ set_field(ExessDuration* const out,
 }
 
 static ExessResult
-read_duration_date(ExessDuration* const out, const char* const str)
+read_duration_date(ExessDuration* const out,
+                   const size_t         len,
+                   const char* const    str)
 {
   size_t      i          = 0U;
   ExessStatus st         = EXESS_SUCCESS;
   unsigned    last_field = 0U;
 
-  while (!st && last_field < DAY && str[i] != 'T') {
+  while (!st && last_field < DAY && peek(len, str, i) != 'T') {
     // Read the unsigned integer value
     uint64_t          value = 0U;
-    const ExessResult r     = read_digits(&value, str + i);
+    const ExessResult r     = read_digits(&value, len - i, str + i);
     i += r.count;
     if (r.status) {
       st = r.count ? r.status : EXESS_SUCCESS;
@@ -63,10 +69,11 @@ read_duration_date(ExessDuration* const out, const char* const str)
     }
 
     // Read Y, M, or D field tag
-    const Field field = (str[i] == 'Y')   ? YEAR
-                        : (str[i] == 'M') ? MONTH
-                        : (str[i] == 'D') ? DAY
-                                          : NONE;
+    const char  tag   = peek(len, str, i);
+    const Field field = (tag == 'Y')   ? YEAR
+                        : (tag == 'M') ? MONTH
+                        : (tag == 'D') ? DAY
+                                       : NONE;
     if (!field) {
       return result(EXESS_EXPECTED_DATE_TAG, i);
     }
@@ -81,7 +88,9 @@ read_duration_date(ExessDuration* const out, const char* const str)
 }
 
 static ExessResult
-read_duration_time(ExessDuration* const out, const char* const str)
+read_duration_time(ExessDuration* const out,
+                   const size_t         len,
+                   const char* const    str)
 {
   size_t      i          = 0U;
   ExessStatus st         = EXESS_SUCCESS;
@@ -90,33 +99,34 @@ read_duration_time(ExessDuration* const out, const char* const str)
   while (!st && last_field < SECOND) {
     // Read the unsigned integer value
     uint64_t          value = 0U;
-    const ExessResult r     = read_digits(&value, str + i);
+    const ExessResult r     = read_digits(&value, len - i, str + i);
     i += r.count;
     if (r.status) {
       st = r.count ? r.status : EXESS_SUCCESS;
       break;
     }
 
-    Field field = YEAR;
-    if (str[i] == '.') {
+    Field      field = YEAR;
+    const char tag   = peek(len, str, i);
+    if (tag == '.') {
       uint32_t nanoseconds = 0U;
-      if (!is_digit(str[++i])) {
+      if (!is_digit(peek(len, str, ++i))) {
         return result(EXESS_EXPECTED_DIGIT, i);
       }
 
-      const ExessResult s = read_nanoseconds(&nanoseconds, str + i);
+      const ExessResult s = read_nanoseconds(&nanoseconds, len - i, str + i);
       i += s.count;
-      if (str[i] != 'S') {
+      if (peek(len, str, i) != 'S') {
         return result(EXESS_EXPECTED_SECOND_TAG, i);
       }
 
       field            = SECOND;
       out->nanoseconds = (int32_t)nanoseconds;
-    } else if (str[i] == 'H') {
+    } else if (tag == 'H') {
       field = HOUR;
-    } else if (str[i] == 'M') {
+    } else if (tag == 'M') {
       field = MINUTE;
-    } else if (str[i] == 'S') {
+    } else if (tag == 'S') {
       field = SECOND;
     } else {
       return result(EXESS_EXPECTED_TIME_TAG, i);
@@ -131,32 +141,64 @@ read_duration_time(ExessDuration* const out, const char* const str)
   return i > 0 ? result(st, i) : result(EXESS_EXPECTED_DIGIT, i);
 }
 
-static ExessOrder
-compare_duration_partial(const ExessDuration lhs, const ExessDuration rhs)
+void
+duration_instants(const ExessDuration duration,
+                  ExessEpochTime      instants[DURATION_N_REFERENCES])
 {
   // See https://www.w3.org/TR/xmlschema11-2/#duration
+  static const int64_t ref_months[DURATION_N_REFERENCES] = {
+    (1696 * 12) + 8, (1697 * 12) + 1, (1903 * 12) + 2, (1903 * 12) + 6};
+
+  static const int64_t giga            = 1000000000;
+  static const int64_t seconds_per_day = 24 * 60 * 60;
+
+  // Nanoseconds are the same from every reference, which are all at midnight
+  const int64_t borrow  = (duration.nanoseconds < 0) ? 1 : 0;
+  const int64_t seconds = (int64_t)duration.seconds - borrow;
+  const int64_t nanos   = duration.nanoseconds + (borrow * giga);
+
+  // Each reference is the first of a month, so adding months never clamps
+  for (unsigned i = 0U; i < DURATION_N_REFERENCES; ++i) {
+    const int64_t  months = ref_months[i] + duration.months;
+    const int64_t  year   = (months >= 0 ? months : months - 11) / 12;
+    const unsigned month  = (unsigned)(months - (year * 12)) + 1U;
+    const int64_t  days   = days_from_civil(year, month, 1);
+
+    instants[i].seconds     = (days * seconds_per_day) + seconds;
+    instants[i].nanoseconds = (uint32_t)nanos;
+  }
+}
 
-  static const ExessDateTime a = {1696, 9, 1, EXESS_LOCAL, 0, 0, 0, 0};
-  static const ExessDateTime b = {1697, 2, 1, EXESS_LOCAL, 0, 0, 0, 0};
-  static const ExessDateTime c = {1903, 3, 1, EXESS_LOCAL, 0, 0, 0, 0};
-  static const ExessDateTime d = {1903, 7, 1, EXESS_LOCAL, 0, 0, 0, 0};
-
-  const ExessOrder cmp = exess_compare_date_time(
-    exess_add_date_time_duration(a, lhs), exess_add_date_time_duration(a, rhs));
-
-  if (cmp == exess_compare_date_time(exess_add_date_time_duration(b, lhs),
-                                     exess_add_date_time_duration(b, rhs)) &&
-      cmp == exess_compare_date_time(exess_add_date_time_duration(c, lhs),
-                                     exess_add_date_time_duration(c, rhs)) &&
-      cmp == exess_compare_date_time(exess_add_date_time_duration(d, lhs),
-                                     exess_add_date_time_duration(d, rhs))) {
-    return cmp;
+static ExessOrder
+compare_instants(const ExessEpochTime lhs, const ExessEpochTime rhs)
+{
+  return (lhs.seconds < rhs.seconds)           ? EXESS_ORDER_STRICTLY_LESS
+         : (rhs.seconds < lhs.seconds)         ? EXESS_ORDER_STRICTLY_GREATER
+         : (lhs.nanoseconds < rhs.nanoseconds) ? EXESS_ORDER_STRICTLY_LESS
+         : (rhs.nanoseconds < lhs.nanoseconds) ? EXESS_ORDER_STRICTLY_GREATER
+                                               : EXESS_ORDER_EQUAL;
+}
+
+static ExessOrder
+compare_duration_partial(const ExessDuration lhs, const ExessDuration rhs)
+{
+  ExessEpochTime lhs_instants[DURATION_N_REFERENCES];
+  ExessEpochTime rhs_instants[DURATION_N_REFERENCES];
+  duration_instants(lhs, lhs_instants);
+  duration_instants(rhs, rhs_instants);
+
+  // Ordered only if the order is the same from every reference
+  const ExessOrder cmp = compare_instants(lhs_instants[0], rhs_instants[0]);
+  for (unsigned i = 1U; i < DURATION_N_REFERENCES; ++i) {
+    if (compare_instants(lhs_instants[i], rhs_instants[i]) != cmp) {
+      return (lhs.months < rhs.months)     ? EXESS_ORDER_MAYBE_LESS
+             : (rhs.months < lhs.months)   ? EXESS_ORDER_MAYBE_GREATER
+             : (lhs.seconds < rhs.seconds) ? EXESS_ORDER_MAYBE_LESS
+                                           : EXESS_ORDER_MAYBE_GREATER;
+    }
   }
 
-  return (lhs.months < rhs.months)     ? EXESS_ORDER_MAYBE_LESS
-         : (rhs.months < lhs.months)   ? EXESS_ORDER_MAYBE_GREATER
-         : (lhs.seconds < rhs.seconds) ? EXESS_ORDER_MAYBE_LESS
-                                       : EXESS_ORDER_MAYBE_GREATER;
+  return cmp;
 }
 
 ExessOrder
@@ -186,24 +228,24 @@ exess_compare_duration(const ExessDuration lhs, const ExessDuration rhs)
 }
 
 ExessResult
-exess_read_duration(ExessDuration* const out, const char* const str)
+read_duration(ExessDuration* const out, const size_t len, const char* const str)
 {
   memset(out, 0, sizeof(*out));
 
-  size_t i           = skip_whitespace(str);
+  size_t i           = skip_whitespace(len, str);
   bool   is_negative = false;
-  if (str[i] == '-') {
+  if (peek(len, str, i) == '-') {
     is_negative = true;
     ++i;
   }
 
-  if (str[i] != 'P') {
+  if (peek(len, str, i) != 'P') {
     return result(EXESS_EXPECTED_DURATION, i);
   }
 
   ++i;
-  if (str[i] != 'T') {
-    ExessResult r = read_duration_date(out, str + i);
+  if (peek(len, str, i) != 'T') {
+    ExessResult r = read_duration_date(out, len - i, str + i);
     if (r.status) {
       return result(r.status, i + r.count);
     }
@@ -211,10 +253,10 @@ exess_read_duration(ExessDuration* const out, const char* const str)
     i += r.count;
   }
 
-  if (str[i] == 'T') {
+  if (peek(len, str, i) == 'T') {
     ++i;
 
-    ExessResult r = read_duration_time(out, str + i);
+    ExessResult r = read_duration_time(out, len - i, str + i);
     if (r.status) {
       return result(r.status, i + r.count);
     }
@@ -231,6 +273,12 @@ exess_read_duration(ExessDuration* const out, const char* const str)
   return result(EXESS_SUCCESS, i);
 }
 
+ExessResult
+exess_read_duration(ExessDuration* const out, const char* const str)
+{
+  return read_duration(out, SIZE_MAX, str);
+}
+
 static size_t
 write_int_field(ExessResult*   r,
                 const uint32_t value,
@@ -242,13 +290,10 @@ write_int_field(ExessResult*   r,
   if (!r->status) {
     if (value == 0) {
       *r = result(EXESS_SUCCESS, 0);
-    } else if (!buf) {
-      *r = exess_write_uint(value, buf_size, buf);
-      ++r->count;
     } else {
-      *r = exess_write_uint(value, buf_size - i, buf + i);
+      *r = write_digits(value, buf_size, buf, i);
       if (!r->status) {
-        buf[i + r->count++] = tag;
+        r->count += write_char(tag, buf_size, buf, i + r->count);
       }
     }
   }
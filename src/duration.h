@@ -0,0 +1,27 @@
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_DURATION_H
+#define EXESS_SRC_DURATION_H
+
+#include <exess/exess.h>
+
+/// The number of reference dateTimes that durations are compared from
+#define DURATION_N_REFERENCES 4U
+
+/**
+   Get the local instants reached by adding a duration to each reference.
+
+   These are the dateTimes from the XSD specification that
+   exess_compare_duration() uses, in order: 1696-09-01, 1697-02-01,
+   1903-03-01, and 1903-07-01, all at midnight.  Two durations are ordered,
+   or equal, if and only if all of their instants are.
+
+   Unlike with exess_add_date_time_duration(), the result is never infinite,
+   since the years in these instants aren't limited to 16 bits.
+*/
+void
+duration_instants(ExessDuration  duration,
+                  ExessEpochTime instants[DURATION_N_REFERENCES]);
+
+#endif // EXESS_SRC_DURATION_H
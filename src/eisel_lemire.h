@@ -0,0 +1,34 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_EISEL_LEMIRE_H
+#define EXESS_SRC_EISEL_LEMIRE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Minimum decimal exponent supported by eisel_lemire()
+static const int eisel_lemire_min_expt10 = -342;
+
+/// Maximum decimal exponent supported by eisel_lemire()
+static const int eisel_lemire_max_expt10 = 308;
+
+/**
+   Convert a decimal number to the nearest double if it's easy to do so.
+
+   This quickly calculates the correctly rounded result using only a 128-bit
+   approximation of the power of 10, which works for almost all inputs.  For
+   the few where it doesn't, a slower method must be used instead.
+
+   @param significand Decimal significand, which must be non-zero.
+   @param expt10 Decimal exponent, from #eisel_lemire_min_expt10 to
+   #eisel_lemire_max_expt10 inclusive.
+   @param[out] out Set to the positive result on success.
+   @return True if `out` was set to the correctly rounded result, or false if
+   the result is subnormal, infinite, or too close to halfway between two
+   doubles to determine with this method.
+*/
+bool
+eisel_lemire(uint64_t significand, int expt10, double* out);
+
+#endif // EXESS_SRC_EISEL_LEMIRE_H
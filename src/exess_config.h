@@ -1,4 +1,4 @@
-// Copyright 2021-2023 David Robillard <d@drobilla.net>
+// Copyright 2021-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 /*
@@ -62,6 +62,32 @@
 #    endif
 #  endif
 
+// GCC and clang on 64-bit targets: unsigned __int128
+#  if !defined(HAVE_INT128)
+#    if defined(__SIZEOF_INT128__)
+#      define HAVE_INT128 1
+#    endif
+#  endif
+
+// MSVC on x64: _umul128()
+#  if !defined(HAVE_UMUL128)
+#    if defined(_MSC_VER) && defined(_M_X64)
+#      define HAVE_UMUL128 1
+#    endif
+#  endif
+
+// GCC and clang on x86: cpuid.h, and SIMD intrinsics with target attributes
+#  if !defined(HAVE_X86_SIMD)
+#    if defined(__x86_64__) || defined(__i386__)
+#      if (defined(__clang__) && __clang_major__ >= 7) || \
+        (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8)
+#        define HAVE_X86_SIMD 1
+#      endif
+#    endif
+#  endif
+
+// Note that POSIX threads aren't detected here since linking is required
+
 #endif // !defined(EXESS_NO_DEFAULT_CONFIG)
 
 /*
@@ -84,4 +110,28 @@
 #  define USE_BUILTIN_CLZLL 0
 #endif
 
+#if defined(HAVE_INT128) && HAVE_INT128
+#  define USE_INT128 1
+#else
+#  define USE_INT128 0
+#endif
+
+#if defined(HAVE_UMUL128) && HAVE_UMUL128
+#  define USE_UMUL128 1
+#else
+#  define USE_UMUL128 0
+#endif
+
+#if defined(HAVE_PTHREADS) && HAVE_PTHREADS
+#  define USE_PTHREADS 1
+#else
+#  define USE_PTHREADS 0
+#endif
+
+#if defined(HAVE_X86_SIMD) && HAVE_X86_SIMD
+#  define USE_X86_SIMD 1
+#else
+#  define USE_X86_SIMD 0
+#endif
+
 #endif // EXESS_SRC_CONFIG_H
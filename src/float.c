@@ -1,26 +1,34 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "floating_decimal.h"
+#include "read_value.h"
 #include "result.h"
 #include "scientific.h"
 
 #include <exess/exess.h>
 
 #include <math.h>
+#include <stdint.h>
 #include <string.h>
 
 ExessResult
-exess_read_float(float* const out, const char* const str)
+read_float(float* const out, const size_t len, const char* const str)
 {
   double            value = (double)NAN;
-  const ExessResult r     = exess_read_double(&value, str);
+  const ExessResult r     = read_double(&value, len, str);
 
   *out = (float)value;
 
   return r;
 }
 
+ExessResult
+exess_read_float(float* const out, const char* const str)
+{
+  return read_float(out, SIZE_MAX, str);
+}
+
 ExessResult
 exess_write_float(const float value, const size_t buf_size, char* const buf)
 {
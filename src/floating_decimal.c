@@ -1,8 +1,8 @@
-// Copyright 2019-2024 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "floating_decimal.h"
-#include "digits.h"
+#include "shortest.h"
 #include "warnings.h"
 
 #include <assert.h>
@@ -39,7 +39,7 @@ number_kind(const double d)
 }
 
 static ExessFloatingDecimal
-measure_decimal(const double d, const unsigned max_precision)
+measure_decimal(const double d, const bool is_float)
 {
   ExessFloatingDecimal value = {number_kind(d), 0, 0, {0}};
 
@@ -49,7 +49,8 @@ measure_decimal(const double d, const unsigned max_precision)
 
   // Get decimal digits
   const ExessDigitCount count =
-    generate_digits(fabs(d), max_precision, value.digits);
+    is_float ? generate_float_digits((float)fabs(d), value.digits)
+             : generate_shortest_digits(fabs(d), value.digits);
 
   assert(count.count == 1 || value.digits[count.count - 1] != '0');
 
@@ -62,11 +63,11 @@ measure_decimal(const double d, const unsigned max_precision)
 ExessFloatingDecimal
 measure_float(const float f)
 {
-  return measure_decimal((double)f, FLT_DECIMAL_DIG);
+  return measure_decimal((double)f, true);
 }
 
 ExessFloatingDecimal
 measure_double(const double d)
 {
-  return measure_decimal(d, DBL_DECIMAL_DIG);
+  return measure_decimal(d, false);
 }
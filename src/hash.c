@@ -0,0 +1,288 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "duration.h"
+
+#include <exess/exess.h>
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/// Mix the bits of a 64-bit integer (the MurmurHash3 finalizer)
+static inline uint64_t
+mix(uint64_t h)
+{
+  h ^= h >> 33U;
+  h *= UINT64_C(0xFF51AFD7ED558CCD);
+  h ^= h >> 33U;
+  h *= UINT64_C(0xC4CEB9FE1A85EC53);
+  h ^= h >> 33U;
+  return h;
+}
+
+/// Combine a hash with another 64-bit word
+static inline uint64_t
+combine(const uint64_t h, const uint64_t word)
+{
+  static const uint64_t golden = UINT64_C(0x9E3779B97F4A7C15);
+
+  return mix(h ^ (word + golden + (h << 6U) + (h >> 2U)));
+}
+
+static inline uint64_t
+hash_bool(const uint64_t seed, const bool value)
+{
+  return combine(seed, value);
+}
+
+static inline uint64_t
+hash_signed(const uint64_t seed, const int64_t value)
+{
+  return combine(seed, (uint64_t)value);
+}
+
+static inline uint64_t
+hash_unsigned(const uint64_t seed, const uint64_t value)
+{
+  return combine(seed, value);
+}
+
+static inline uint64_t
+hash_double(const uint64_t seed, const double value)
+{
+  // Equal values must have equal hashes, so -0 is 0 and all NaNs are the same
+  const double canonical = isnan(value) ? (double)NAN : (value + 0.0);
+
+  uint64_t rep = 0U;
+  memcpy(&rep, &canonical, sizeof(rep));
+  return combine(seed, rep);
+}
+
+static inline uint64_t
+hash_float(const uint64_t seed, const float value)
+{
+  const float canonical = isnan(value) ? NAN : (value + 0.0f);
+
+  uint32_t rep = 0U;
+  memcpy(&rep, &canonical, sizeof(rep));
+  return combine(seed, rep);
+}
+
+static inline uint64_t
+hash_duration(const uint64_t seed, const ExessDuration value)
+{
+  // Durations are equal if they reach the same instants from every reference
+  ExessEpochTime instants[DURATION_N_REFERENCES];
+  duration_instants(value, instants);
+
+  uint64_t h = seed;
+  for (unsigned i = 0U; i < DURATION_N_REFERENCES; ++i) {
+    h = hash_signed(h, instants[i].seconds);
+  }
+
+  return hash_unsigned(h, instants[0].nanoseconds);
+}
+
+static inline uint64_t
+hash_date_time(const uint64_t seed, const ExessDateTime value)
+{
+  // Equal dateTimes are the same instant, regardless of timezone
+  const ExessEpochTime time = exess_date_time_to_epoch(value);
+
+  return combine(combine(seed, (uint64_t)time.seconds), time.nanoseconds);
+}
+
+static inline uint64_t
+hash_time(const uint64_t seed, const ExessTime value)
+{
+  // Use the same reference date as exess_compare_time()
+  const ExessDateTime datetime = {1972,
+                                  12U,
+                                  31U,
+                                  value.zone,
+                                  value.hour,
+                                  value.minute,
+                                  value.second,
+                                  value.nanosecond};
+
+  return hash_date_time(seed, datetime);
+}
+
+static inline uint64_t
+hash_date(const uint64_t seed, const ExessDate value)
+{
+  const ExessDateTime datetime = {
+    value.year, value.month, value.day, value.zone, 0U, 0U, 0U, 0U};
+
+  return hash_date_time(seed, datetime);
+}
+
+static uint64_t
+hash_blob(const uint64_t seed, const size_t size, const uint8_t* const data)
+{
+  uint64_t h = combine(seed, size);
+  size_t   i = 0U;
+
+  for (; i + 8U <= size; i += 8U) {
+    uint64_t word = 0U;
+    memcpy(&word, data + i, sizeof(word));
+    h = combine(h, word);
+  }
+
+  if (i < size) {
+    uint64_t word = 0U;
+    memcpy(&word, data + i, size - i);
+    h = combine(h, word);
+  }
+
+  return h;
+}
+
+uint64_t
+exess_hash_value(const ExessDatatype datatype,
+                 const size_t        value_size,
+                 const void* const   value)
+{
+  const uint64_t seed = mix((uint64_t)datatype + 1U);
+
+  if (value_size < exess_value_size(datatype)) {
+    return seed;
+  }
+
+  switch (datatype) {
+  case EXESS_NOTHING:
+    break;
+  case EXESS_BOOLEAN:
+    return hash_bool(seed, *(const bool*)value);
+  case EXESS_DECIMAL:
+  case EXESS_DOUBLE:
+    return hash_double(seed, *(const double*)value);
+  case EXESS_FLOAT:
+    return hash_float(seed, *(const float*)value);
+  case EXESS_INTEGER:
+  case EXESS_NON_POSITIVE_INTEGER:
+  case EXESS_NEGATIVE_INTEGER:
+  case EXESS_LONG:
+    return hash_signed(seed, *(const int64_t*)value);
+  case EXESS_INT:
+    return hash_signed(seed, *(const int32_t*)value);
+  case EXESS_SHORT:
+    return hash_signed(seed, *(const int16_t*)value);
+  case EXESS_BYTE:
+    return hash_signed(seed, *(const int8_t*)value);
+  case EXESS_NON_NEGATIVE_INTEGER:
+  case EXESS_ULONG:
+  case EXESS_POSITIVE_INTEGER:
+    return hash_unsigned(seed, *(const uint64_t*)value);
+  case EXESS_UINT:
+    return hash_unsigned(seed, *(const uint32_t*)value);
+  case EXESS_USHORT:
+    return hash_unsigned(seed, *(const uint16_t*)value);
+  case EXESS_UBYTE:
+    return hash_unsigned(seed, *(const uint8_t*)value);
+  case EXESS_DURATION:
+    return hash_duration(seed, *(const ExessDuration*)value);
+  case EXESS_DATE_TIME:
+    return hash_date_time(seed, *(const ExessDateTime*)value);
+  case EXESS_TIME:
+    return hash_time(seed, *(const ExessTime*)value);
+  case EXESS_DATE:
+    return hash_date(seed, *(const ExessDate*)value);
+  case EXESS_HEX:
+  case EXESS_BASE64:
+    return hash_blob(seed, value_size, (const uint8_t*)value);
+  }
+
+  return seed;
+}
+
+/// Hash every value in a batch with the hasher for a fixed-size value type
+#define HASH_VALUES(Type, hash)                    \
+  do {                                             \
+    const Type* const typed = (const Type*)values; \
+    for (size_t i = 0U; i < n_values; ++i) {       \
+      hashes[i] = hash(seed, typed[i]);            \
+    }                                              \
+  } while (0)
+
+ExessStatus
+exess_hash_values(const ExessDatatype datatype,
+                  const size_t        n_values,
+                  const size_t        values_size,
+                  const void* const   values,
+                  uint64_t* const     hashes)
+{
+  const size_t value_size = exess_value_size(datatype);
+  if (!value_size) {
+    return EXESS_UNSUPPORTED;
+  }
+
+  if (values_size / value_size < n_values) {
+    return EXESS_BAD_VALUE;
+  }
+
+  const uint64_t seed = mix((uint64_t)datatype + 1U);
+  switch (datatype) {
+  case EXESS_NOTHING:
+    break;
+  case EXESS_BOOLEAN:
+    HASH_VALUES(bool, hash_bool);
+    break;
+  case EXESS_DECIMAL:
+  case EXESS_DOUBLE:
+    HASH_VALUES(double, hash_double);
+    break;
+  case EXESS_FLOAT:
+    HASH_VALUES(float, hash_float);
+    break;
+  case EXESS_INTEGER:
+  case EXESS_NON_POSITIVE_INTEGER:
+  case EXESS_NEGATIVE_INTEGER:
+  case EXESS_LONG:
+    HASH_VALUES(int64_t, hash_signed);
+    break;
+  case EXESS_INT:
+    HASH_VALUES(int32_t, hash_signed);
+    break;
+  case EXESS_SHORT:
+    HASH_VALUES(int16_t, hash_signed);
+    break;
+  case EXESS_BYTE:
+    HASH_VALUES(int8_t, hash_signed);
+    break;
+  case EXESS_NON_NEGATIVE_INTEGER:
+  case EXESS_ULONG:
+  case EXESS_POSITIVE_INTEGER:
+    HASH_VALUES(uint64_t, hash_unsigned);
+    break;
+  case EXESS_UINT:
+    HASH_VALUES(uint32_t, hash_unsigned);
+    break;
+  case EXESS_USHORT:
+    HASH_VALUES(uint16_t, hash_unsigned);
+    break;
+  case EXESS_UBYTE:
+    HASH_VALUES(uint8_t, hash_unsigned);
+    break;
+  case EXESS_DURATION:
+    HASH_VALUES(ExessDuration, hash_duration);
+    break;
+  case EXESS_DATE_TIME:
+    HASH_VALUES(ExessDateTime, hash_date_time);
+    break;
+  case EXESS_TIME:
+    HASH_VALUES(ExessTime, hash_time);
+    break;
+  case EXESS_DATE:
+    HASH_VALUES(ExessDate, hash_date);
+    break;
+  case EXESS_HEX:
+  case EXESS_BASE64:
+    break;
+  }
+
+  return EXESS_SUCCESS;
+}
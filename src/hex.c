@@ -1,13 +1,16 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
+#include "hex_simd.h"
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "string_utils.h"
 #include "write_utils.h"
 
 #include <exess/exess.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -39,14 +42,25 @@ exess_decoded_hex_size(const size_t length)
 }
 
 ExessVariableResult
-exess_read_hex(const size_t out_size, void* const out, const char* const str)
+read_hex(const size_t      out_size,
+         void* const       out,
+         const size_t      len,
+         const char* const str)
 {
   uint8_t* const uout  = (uint8_t*)out;
-  const size_t   first = skip_whitespace(str);
-  size_t         i     = first;
-  size_t         o     = 0U;
+  const size_t   first = skip_whitespace(len, str);
+
+  // Bound the string so the fast path never reads past a null terminator
+  const size_t end = string_length(len, str);
 
-  while (str[i]) {
+  // Decode as much as possible quickly, then the remainder and any errors
+  size_t i = first;
+  if (i < end) {
+    i += decode_hex_blocks(end - i, (const uint8_t*)str + i, out_size, uout);
+  }
+
+  size_t o = (i - first) / 2U;
+  while (peek(len, str, i)) {
     const char    hi_char = str[i];
     const uint8_t hi      = decode_nibble(hi_char);
     if (hi == UINT8_MAX) {
@@ -55,7 +69,7 @@ exess_read_hex(const size_t out_size, void* const out, const char* const str)
 
     ++i;
 
-    const char lo_char = str[i];
+    const char lo_char = peek(len, str, i);
     if (!lo_char) {
       return vresult(EXESS_EXPECTED_HEX, i, o);
     }
@@ -77,6 +91,19 @@ exess_read_hex(const size_t out_size, void* const out, const char* const str)
   return vresult(EXESS_SUCCESS, i, o);
 }
 
+ExessVariableResult
+exess_read_hex(const size_t out_size, void* const out, const char* const str)
+{
+  return read_hex(out_size, out, SIZE_MAX, str);
+}
+
+ExessVariableResult
+exess_read_hex_in_place(const size_t len, char* const str)
+{
+  // Decoding never writes past the characters that have already been read
+  return read_hex(len, str, len, str);
+}
+
 ExessResult
 exess_write_hex(const size_t      data_size,
                 const void* const data,
@@ -92,10 +119,12 @@ exess_write_hex(const size_t      data_size,
     return result(EXESS_NO_SPACE, 0);
   }
 
-  const uint8_t* const in = (const uint8_t*)data;
-  size_t               o  = 0U;
+  // Encode most of the data quickly, then the remainder
+  const uint8_t* const in     = (const uint8_t*)data;
+  const size_t         n_fast = encode_hex_blocks(data_size, in, (uint8_t*)buf);
+  size_t               o      = 2U * n_fast;
 
-  for (size_t i = 0; i < data_size; ++i) {
+  for (size_t i = n_fast; i < data_size; ++i) {
     const uint8_t hi = (in[i] & 0xF0U) >> 4U;
     const uint8_t lo = (in[i] & 0x0FU);
 
@@ -105,3 +134,69 @@ exess_write_hex(const size_t      data_size,
 
   return end_write(EXESS_SUCCESS, buf_size, buf, o);
 }
+
+void
+exess_hex_decoder_init(ExessHexDecoder* const decoder)
+{
+  decoder->high     = 0U;
+  decoder->has_high = false;
+}
+
+ExessVariableResult
+exess_hex_decoder_feed(ExessHexDecoder* const decoder,
+                       const size_t           len,
+                       const char* const      chunk,
+                       const size_t           out_size,
+                       void* const            out)
+{
+  uint8_t* const uout = (uint8_t*)out;
+  size_t         i    = 0U;
+  size_t         o    = 0U;
+
+  while (i < len) {
+    // Skip whitespace and decode any run of plain digits quickly between bytes
+    if (!decoder->has_high) {
+      i += skip_whitespace(len - i, chunk + i);
+      if (i == len) {
+        break;
+      }
+
+      const size_t n_fast = decode_hex_blocks(
+        len - i, (const uint8_t*)chunk + i, out_size - o, uout + o);
+      if (n_fast) {
+        i += n_fast;
+        o += n_fast / 2U;
+        continue;
+      }
+    }
+
+    const uint8_t nibble = decode_nibble(chunk[i]);
+    if (nibble == UINT8_MAX) {
+      return vresult(EXESS_EXPECTED_HEX, i, o);
+    }
+
+    if (!decoder->has_high) {
+      decoder->high     = nibble;
+      decoder->has_high = true;
+      ++i;
+      continue;
+    }
+
+    // Leave the second digit unread if there's no space for the byte
+    if (o >= out_size) {
+      return vresult(EXESS_NO_SPACE, i, o);
+    }
+
+    uout[o++]         = (uint8_t)(((unsigned)decoder->high << 4U) | nibble);
+    decoder->has_high = false;
+    ++i;
+  }
+
+  return vresult(EXESS_SUCCESS, i, o);
+}
+
+ExessStatus
+exess_hex_decoder_finish(const ExessHexDecoder* const decoder)
+{
+  return decoder->has_high ? EXESS_EXPECTED_HEX : EXESS_SUCCESS;
+}
@@ -0,0 +1,263 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+/*
+  Vectorized hex decoding and encoding.
+
+  Decoding validates a whole block of characters at once, converts each to
+  its nibble value, then merges pairs of nibbles into bytes with a multiply
+  and add.  Encoding looks up each nibble in a table with a byte shuffle.  As
+  with base64, only whole blocks of digits are handled here, and the scalar
+  code in hex.c deals with everything else.
+*/
+
+#include "hex_simd.h"
+
+#include "attributes.h"
+#include "cpu.h"
+#include "exess_config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if USE_X86_SIMD
+
+#  include <immintrin.h>
+
+/// Convert 16 hex digits to nibble values, or return false if any are invalid
+EXESS_I_TARGET("sse4.1")
+static inline int
+unhex_16(__m128i* const chars)
+{
+  const __m128i in    = *chars;
+  const __m128i lower = _mm_or_si128(in, _mm_set1_epi8(0x20));
+
+  // Characters are either digits, or letters in either case
+  const __m128i is_digit = _mm_and_si128(
+    _mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)),
+    _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), in));
+
+  const __m128i is_alpha = _mm_and_si128(
+    _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+    _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+
+  if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF) {
+    return 0;
+  }
+
+  *chars = _mm_blendv_epi8(_mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)),
+                           _mm_sub_epi8(in, _mm_set1_epi8('0')),
+                           is_digit);
+  return 1;
+}
+
+EXESS_I_TARGET("sse4.1")
+static size_t
+decode_sse41(const size_t         len,
+             const uint8_t* const str,
+             const size_t         out_size,
+             uint8_t* const       out)
+{
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; len - i >= 16U && out_size - o >= 8U; i += 16U, o += 8U) {
+    __m128i nibbles = _mm_loadu_si128((const void*)(str + i));
+    if (!unhex_16(&nibbles)) {
+      break;
+    }
+
+    // Merge pairs of nibbles into 16-bit values, then pack those into bytes
+    const __m128i merged = _mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110));
+
+    _mm_storel_epi64((void*)(out + o), _mm_packus_epi16(merged, merged));
+  }
+
+  return i;
+}
+
+EXESS_I_TARGET("avx2")
+static size_t
+decode_avx2(const size_t         len,
+            const uint8_t* const str,
+            const size_t         out_size,
+            uint8_t* const       out)
+{
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; len - i >= 32U && out_size - o >= 16U; i += 32U, o += 16U) {
+    const __m256i in    = _mm256_loadu_si256((const void*)(str + i));
+    const __m256i lower = _mm256_or_si256(in, _mm256_set1_epi8(0x20));
+
+    const __m256i is_digit =
+      _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('0' - 1)),
+                       _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), in));
+
+    const __m256i is_alpha =
+      _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                       _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+
+    const __m256i is_hex = _mm256_or_si256(is_digit, is_alpha);
+    if (_mm256_movemask_epi8(is_hex) != -1) {
+      break;
+    }
+
+    const __m256i nibbles =
+      _mm256_blendv_epi8(_mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)),
+                         _mm256_sub_epi8(in, _mm256_set1_epi8('0')),
+                         is_digit);
+
+    // Pack within each lane, then move the low half of each lane together
+    const __m256i merged =
+      _mm256_maddubs_epi16(nibbles, _mm256_set1_epi16(0x0110));
+    const __m256i packed = _mm256_permute4x64_epi64(
+      _mm256_packus_epi16(merged, merged), _MM_SHUFFLE(3, 1, 2, 0));
+
+    _mm_storeu_si128((void*)(out + o), _mm256_castsi256_si128(packed));
+  }
+
+  return i;
+}
+
+EXESS_I_TARGET("sse4.1")
+static size_t
+encode_sse41(const size_t size, const uint8_t* const data, uint8_t* const out)
+{
+  const __m128i digits = _mm_setr_epi8('0',
+                                       '1',
+                                       '2',
+                                       '3',
+                                       '4',
+                                       '5',
+                                       '6',
+                                       '7',
+                                       '8',
+                                       '9',
+                                       'A',
+                                       'B',
+                                       'C',
+                                       'D',
+                                       'E',
+                                       'F');
+
+  const __m128i low_mask = _mm_set1_epi8(0x0F);
+
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; size - i >= 16U; i += 16U, o += 32U) {
+    const __m128i in = _mm_loadu_si128((const void*)(data + i));
+    const __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), low_mask);
+    const __m128i lo = _mm_and_si128(in, low_mask);
+
+    const __m128i hi_chars = _mm_shuffle_epi8(digits, hi);
+    const __m128i lo_chars = _mm_shuffle_epi8(digits, lo);
+
+    _mm_storeu_si128((void*)(out + o), _mm_unpacklo_epi8(hi_chars, lo_chars));
+    _mm_storeu_si128((void*)(out + o + 16U),
+                     _mm_unpackhi_epi8(hi_chars, lo_chars));
+  }
+
+  return i;
+}
+
+EXESS_I_TARGET("avx2")
+static size_t
+encode_avx2(const size_t size, const uint8_t* const data, uint8_t* const out)
+{
+  const __m256i digits = _mm256_setr_epi8(
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E',
+    'F', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D',
+    'E', 'F');
+
+  const __m256i low_mask = _mm256_set1_epi8(0x0F);
+
+  size_t i = 0U;
+  size_t o = 0U;
+
+  for (; size - i >= 32U; i += 32U, o += 64U) {
+    const __m256i in = _mm256_loadu_si256((const void*)(data + i));
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(in, 4), low_mask);
+    const __m256i lo = _mm256_and_si256(in, low_mask);
+
+    const __m256i hi_chars = _mm256_shuffle_epi8(digits, hi);
+    const __m256i lo_chars = _mm256_shuffle_epi8(digits, lo);
+
+    // Interleave within lanes, then put the lanes back in order
+    const __m256i first  = _mm256_unpacklo_epi8(hi_chars, lo_chars);
+    const __m256i second = _mm256_unpackhi_epi8(hi_chars, lo_chars);
+
+    _mm256_storeu_si256((void*)(out + o),
+                        _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256((void*)(out + o + 32U),
+                        _mm256_permute2x128_si256(first, second, 0x31));
+  }
+
+  return i;
+}
+
+size_t
+decode_hex_blocks(const size_t         len,
+                  const uint8_t* const str,
+                  const size_t         out_size,
+                  uint8_t* const       out)
+{
+  size_t i = 0U;
+
+  if (cpu_supports(CPU_AVX2)) {
+    i += decode_avx2(len, str, out_size, out);
+  }
+
+  if (cpu_supports(CPU_SSE41)) {
+    i += decode_sse41(len - i, str + i, out_size - (i / 2U), out + (i / 2U));
+  }
+
+  return i;
+}
+
+size_t
+encode_hex_blocks(const size_t         size,
+                  const uint8_t* const data,
+                  uint8_t* const       out)
+{
+  size_t i = 0U;
+
+  if (cpu_supports(CPU_AVX2)) {
+    i += encode_avx2(size, data, out);
+  }
+
+  if (cpu_supports(CPU_SSE41)) {
+    i += encode_sse41(size - i, data + i, out + (i * 2U));
+  }
+
+  return i;
+}
+
+#else
+
+size_t
+decode_hex_blocks(const size_t         len,
+                  const uint8_t* const str,
+                  const size_t         out_size,
+                  uint8_t* const       out)
+{
+  (void)len;
+  (void)str;
+  (void)out_size;
+  (void)out;
+  return 0U;
+}
+
+size_t
+encode_hex_blocks(const size_t         size,
+                  const uint8_t* const data,
+                  uint8_t* const       out)
+{
+  (void)size;
+  (void)data;
+  (void)out;
+  return 0U;
+}
+
+#endif // USE_X86_SIMD
@@ -0,0 +1,44 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_HEX_SIMD_H
+#define EXESS_SRC_HEX_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+   Decode as many leading blocks of hex digits as possible with SIMD.
+
+   This only decodes whole blocks which contain only hex digits (in either
+   case), and stops at the first block that doesn't, so the caller can handle
+   the rest like usual.
+
+   @param len The number of characters available in `str`.
+   @param str Hex characters to decode.
+   @param out_size The number of bytes available in `out`.
+   @param out Output buffer for decoded bytes.
+
+   @return The number of characters decoded, which is even and writes 1 byte
+   to `out` for every 2 characters.
+*/
+size_t
+decode_hex_blocks(size_t         len,
+                  const uint8_t* str,
+                  size_t         out_size,
+                  uint8_t*       out);
+
+/**
+   Encode as many leading blocks of bytes as possible to hex with SIMD.
+
+   @param size The number of bytes available in `data`.
+   @param data Bytes to encode.
+   @param out Output buffer, which must have space for the encoded data.
+
+   @return The number of bytes encoded, which writes 2 characters to `out`
+   for every byte.
+*/
+size_t
+encode_hex_blocks(size_t size, const uint8_t* data, uint8_t* out);
+
+#endif // EXESS_SRC_HEX_SIMD_H
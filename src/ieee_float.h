@@ -1,4 +1,4 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_IEEE_FLOAT_H
@@ -8,6 +8,13 @@
 #include <stdint.h>
 #include <string.h>
 
+static const unsigned flt_physical_mant_dig = FLT_MANT_DIG - 1U;
+static const uint32_t flt_mant_mask         = 0x007FFFFFU;
+static const uint32_t flt_expt_mask         = 0x7F800000U;
+static const uint32_t flt_hidden_bit        = 0x00800000U;
+static const int      flt_expt_bias         = 0x7F + FLT_MANT_DIG - 1;
+static const int      flt_subnormal_expt    = -0x7F - FLT_MANT_DIG + 2;
+
 static const unsigned dbl_physical_mant_dig = DBL_MANT_DIG - 1U;
 static const uint64_t dbl_mant_mask         = 0x000FFFFFFFFFFFFFULL;
 static const uint64_t dbl_expt_mask         = 0x7FF0000000000000UL;
@@ -1,13 +1,18 @@
-// Copyright 2019-2023 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_INTMATH_H
 #define EXESS_SRC_INTMATH_H
 
 #include "attributes.h"
+#include "exess_config.h"
 
 #include <stdint.h>
 
+#if USE_UMUL128
+#  include <intrin.h>
+#endif
+
 /// Powers of 10 indexed by exponent, so POW10[e] == 10^e
 static const uint64_t POW10[] = {1ULL,
                                  10ULL,
@@ -30,6 +35,54 @@ static const uint64_t POW10[] = {1ULL,
                                  1000000000000000000ULL,
                                  10000000000000000000ULL};
 
+/// An unsigned 128-bit integer
+typedef struct {
+  uint64_t hi; ///< Most significant 64 bits
+  uint64_t lo; ///< Least significant 64 bits
+} ExessUint128;
+
+#if USE_INT128
+/// A native unsigned 128-bit integer
+__extension__ typedef unsigned __int128 ExessNativeUint128;
+#endif
+
+/// Return the full 128-bit product of `a` and `b`
+static inline ExessUint128
+exess_umul128(const uint64_t a, const uint64_t b)
+{
+#if USE_INT128
+  const ExessNativeUint128 p = (ExessNativeUint128)a * b;
+  const ExessUint128       r = {(uint64_t)(p >> 64U), (uint64_t)p};
+
+  return r;
+
+#elif USE_UMUL128
+  uint64_t           hi = 0U;
+  const uint64_t     lo = _umul128(a, b, &hi);
+  const ExessUint128 r  = {hi, lo};
+
+  return r;
+
+#else
+  static const uint64_t mask = 0xFFFFFFFFU;
+
+  const uint64_t a_lo  = a & mask;
+  const uint64_t a_hi  = a >> 32U;
+  const uint64_t b_lo  = b & mask;
+  const uint64_t b_hi  = b >> 32U;
+  const uint64_t lo_lo = a_lo * b_lo;
+  const uint64_t hi_lo = a_hi * b_lo;
+  const uint64_t lo_hi = a_lo * b_hi;
+  const uint64_t hi_hi = a_hi * b_hi;
+  const uint64_t mid   = (lo_lo >> 32U) + (hi_lo & mask) + lo_hi;
+
+  const ExessUint128 r = {hi_hi + (hi_lo >> 32U) + (mid >> 32U),
+                          (mid << 32U) | (lo_lo & mask)};
+
+  return r;
+#endif
+}
+
 /// Return the number of leading zeros in `i`
 EXESS_I_CONST_FUNC unsigned
 exess_clz32(uint32_t i);
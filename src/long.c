@@ -1,8 +1,8 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
-#include "int_math.h"
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "write_utils.h"
 
@@ -13,18 +13,18 @@
 #include <stdlib.h>
 
 ExessResult
-exess_read_long(int64_t* const out, const char* const str)
+read_long(int64_t* const out, const size_t len, const char* const str)
 {
   *out = 0;
 
   // Skip leading whitespace and read sign if present
-  size_t i    = skip_whitespace(str);
+  size_t i    = skip_whitespace(len, str);
   int    sign = 1;
-  i += read_sign(&sign, &str[i]);
+  i += read_sign(&sign, len - i, &str[i]);
 
   // Read digits
   uint64_t    magnitude = 0;
-  ExessResult r         = read_digits(&magnitude, str + i);
+  ExessResult r         = read_digits(&magnitude, len - i, str + i);
   if (r.status) {
     return result(r.status, i + r.count);
   }
@@ -54,40 +54,21 @@ exess_read_long(int64_t* const out, const char* const str)
   return result(r.status, i);
 }
 
-static size_t
-long_string_length(const int64_t value)
+ExessResult
+exess_read_long(int64_t* const out, const char* const str)
 {
-  if (value == INT64_MIN) {
-    return 20;
-  }
-
-  if (value < 0) {
-    return 1U + exess_num_digits((uint64_t)-value);
-  }
-
-  return exess_num_digits((uint64_t)value);
+  return read_long(out, SIZE_MAX, str);
 }
 
 ExessResult
 exess_write_long(const int64_t value, const size_t buf_size, char* const buf)
 {
-  if (!buf) {
-    return result(EXESS_SUCCESS, long_string_length(value));
-  }
-
-  if (value == INT64_MIN) {
-    return end_write(
-      EXESS_SUCCESS,
-      buf_size,
-      buf,
-      write_string(20, "-9223372036854775808", buf_size, buf, 0));
-  }
-
   const bool     is_negative = value < 0;
-  const uint64_t abs_value   = (uint64_t)(is_negative ? -value : value);
+  const uint64_t abs_value =
+    is_negative ? (0U - (uint64_t)value) : (uint64_t)value;
 
-  size_t      i = (is_negative) ? write_char('-', buf_size, buf, 0) : 0;
-  ExessResult r = write_digits(abs_value, buf_size, buf, i);
+  const size_t      i = is_negative ? write_char('-', buf_size, buf, 0) : 0U;
+  const ExessResult r = write_digits(abs_value, buf_size, buf, i);
 
   return end_write(r.status, buf_size, buf, i + r.count);
 }
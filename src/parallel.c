@@ -0,0 +1,293 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "exess_config.h"
+#include "macros.h"
+
+#include <exess/exess.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if USE_PTHREADS
+#  include <pthread.h>
+#endif
+
+#if USE_PTHREADS
+
+/// Target size of the values in a chunk, so that chunks fit in the L1 cache
+#  define CHUNK_BYTES 16384U
+
+/// Maximum number of threads to start, including the calling thread
+#  define MAX_THREADS 64U
+
+/// Function to process a chunk of values from `begin` to `end`
+typedef ExessStatus (*ChunkFunc)(void* data, size_t begin, size_t end);
+
+/// State shared between threads that process chunks of a batch
+typedef struct {
+  pthread_mutex_t mutex;       ///< Mutex for everything below
+  ChunkFunc       func;        ///< Function to process a chunk
+  void*           data;        ///< Data passed to func
+  size_t          n_values;    ///< Total number of values
+  size_t          chunk_size;  ///< Number of values in a chunk
+  size_t          n_chunks;    ///< Total number of chunks
+  size_t          next_chunk;  ///< Index of the next unprocessed chunk
+  size_t          error_chunk; ///< Index of the first chunk with an error
+  ExessStatus     status;      ///< Status of the first chunk with an error
+} Batch;
+
+static void*
+run_chunks(void* const arg)
+{
+  Batch* const batch = (Batch*)arg;
+
+  for (;;) {
+    // Take the next chunk
+    pthread_mutex_lock(&batch->mutex);
+    const size_t chunk = batch->next_chunk++;
+    pthread_mutex_unlock(&batch->mutex);
+
+    if (chunk >= batch->n_chunks) {
+      break;
+    }
+
+    // Process it and record the first error (in value order)
+    const size_t      begin = chunk * batch->chunk_size;
+    const size_t      end   = MIN(begin + batch->chunk_size, batch->n_values);
+    const ExessStatus st    = batch->func(batch->data, begin, end);
+    if (st) {
+      pthread_mutex_lock(&batch->mutex);
+      if (chunk < batch->error_chunk) {
+        batch->error_chunk = chunk;
+        batch->status      = st;
+      }
+      pthread_mutex_unlock(&batch->mutex);
+    }
+  }
+
+  return NULL;
+}
+
+/// Process all values in chunks with several threads
+static ExessStatus
+run_batch(const unsigned  n_threads,
+          const size_t    n_values,
+          const size_t    value_size,
+          const ChunkFunc func,
+          void* const     data)
+{
+  Batch batch;
+  pthread_mutex_init(&batch.mutex, NULL);
+  batch.func        = func;
+  batch.data        = data;
+  batch.n_values    = n_values;
+  batch.chunk_size  = MAX(1U, CHUNK_BYTES / value_size);
+  batch.n_chunks    = (n_values + batch.chunk_size - 1U) / batch.chunk_size;
+  batch.next_chunk  = 0U;
+  batch.error_chunk = SIZE_MAX;
+  batch.status      = EXESS_SUCCESS;
+
+  // Start other threads, but no more than there are chunks
+  const size_t max_threads = MIN(n_threads, MAX_THREADS);
+  const size_t n_extra     = MIN(max_threads, batch.n_chunks) - 1U;
+  pthread_t    threads[MAX_THREADS];
+  size_t       n_started = 0U;
+  for (; n_started < n_extra; ++n_started) {
+    if (pthread_create(&threads[n_started], NULL, run_chunks, &batch)) {
+      break; // Carry on with fewer threads
+    }
+  }
+
+  // Process chunks in this thread as well, then wait for the others
+  run_chunks(&batch);
+  for (size_t i = 0U; i < n_started; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+
+  pthread_mutex_destroy(&batch.mutex);
+  return batch.status;
+}
+
+typedef struct {
+  ExessDatatype                datatype;
+  size_t                       value_size;
+  const ExessStringView* const strings;
+  char* const                  out;
+  ExessStatus* const           statuses;
+} ReadJob;
+
+static ExessStatus
+read_chunk(void* const data, const size_t begin, const size_t end)
+{
+  const ReadJob* const job = (const ReadJob*)data;
+
+  return exess_read_values(job->datatype,
+                           end - begin,
+                           job->strings + begin,
+                           (end - begin) * job->value_size,
+                           job->out + (begin * job->value_size),
+                           job->statuses ? job->statuses + begin : NULL);
+}
+
+typedef struct {
+  ExessDatatype     datatype;
+  size_t            value_size;
+  const char* const values;
+  size_t* const     offsets;
+  char*             heap;
+} WriteJob;
+
+static ExessStatus
+measure_chunk(void* const data, const size_t begin, const size_t end)
+{
+  const WriteJob* const job = (const WriteJob*)data;
+  ExessStatus           st  = EXESS_SUCCESS;
+
+  // Set each offset to the length of the corresponding string for now
+  for (size_t i = begin; i < end; ++i) {
+    const ExessResult r =
+      exess_write_value(job->datatype,
+                        job->value_size,
+                        job->values + (i * job->value_size),
+                        0U,
+                        NULL);
+
+    st              = st ? st : r.status;
+    job->offsets[i] = r.status ? 0U : r.count;
+  }
+
+  return st;
+}
+
+static ExessStatus
+write_chunk(void* const data, const size_t begin, const size_t end)
+{
+  const WriteJob* const job = (const WriteJob*)data;
+
+  /* Every string is written with a null terminator, which is overwritten by
+     the next string.  The last string in the chunk is written elsewhere and
+     copied, so the terminator doesn't clobber the start of the next chunk,
+     which may have been written by another thread. */
+
+  for (size_t i = begin; i < end; ++i) {
+    const void* const value  = job->values + (i * job->value_size);
+    const size_t      length = job->offsets[i + 1U] - job->offsets[i];
+    if (length) {
+      if (i + 1U < end) {
+        exess_write_value(job->datatype,
+                          job->value_size,
+                          value,
+                          length + 1U,
+                          job->heap + job->offsets[i]);
+      } else {
+        char last[EXESS_MAX_DECIMAL_LENGTH + 1] = {0};
+        exess_write_value(
+          job->datatype, job->value_size, value, sizeof(last), last);
+        memcpy(job->heap + job->offsets[i], last, length);
+      }
+    }
+  }
+
+  return EXESS_SUCCESS;
+}
+
+#endif // USE_PTHREADS
+
+ExessStatus
+exess_parallel_read_values(const unsigned               n_threads,
+                           const ExessDatatype          datatype,
+                           const size_t                 n_values,
+                           const ExessStringView* const strings,
+                           const size_t                 out_size,
+                           void* const                  out,
+                           ExessStatus* const           statuses)
+{
+  const size_t value_size = exess_value_size(datatype);
+
+#if USE_PTHREADS
+  if (n_threads > 1U && value_size && n_values > CHUNK_BYTES / value_size &&
+      out_size / value_size >= n_values) {
+    ReadJob job = {datatype, value_size, strings, (char*)out, statuses};
+
+    return run_batch(n_threads, n_values, value_size, read_chunk, &job);
+  }
+#else
+  (void)n_threads;
+  (void)value_size;
+#endif
+
+  return exess_read_values(
+    datatype, n_values, strings, out_size, out, statuses);
+}
+
+ExessStatus
+exess_parallel_write_values(const unsigned      n_threads,
+                            const ExessDatatype datatype,
+                            const size_t        n_values,
+                            const size_t        values_size,
+                            const void* const   values,
+                            size_t* const       offsets,
+                            size_t* const       heap_size,
+                            char** const        heap,
+                            const ExessGrowFunc grow,
+                            void* const         grow_handle)
+{
+  const size_t value_size = exess_value_size(datatype);
+
+#if USE_PTHREADS
+  if (n_threads > 1U && value_size && n_values > CHUNK_BYTES / value_size &&
+      values_size / value_size >= n_values) {
+    WriteJob job = {datatype, value_size, (const char*)values, offsets, NULL};
+
+    // Measure every string
+    const ExessStatus st =
+      run_batch(n_threads, n_values, value_size, measure_chunk, &job);
+
+    // Convert lengths to offsets
+    size_t total = 0U;
+    for (size_t i = 0U; i < n_values; ++i) {
+      const size_t length = offsets[i];
+      offsets[i]          = total;
+      total += length;
+    }
+    offsets[n_values] = total;
+
+    // Grow the heap to fit everything if necessary
+    if (!*heap || *heap_size <= total) {
+      size_t      new_size = *heap_size;
+      char* const new_heap =
+        grow ? grow(grow_handle, total + 1U, &new_size, *heap) : NULL;
+      if (!new_heap) {
+        return EXESS_NO_SPACE;
+      }
+
+      *heap_size = new_size;
+      *heap      = new_heap;
+      if (new_size <= total) {
+        return EXESS_NO_SPACE;
+      }
+    }
+
+    // Write every string into place
+    job.heap = *heap;
+    run_batch(n_threads, n_values, value_size, write_chunk, &job);
+    (*heap)[total] = '\0';
+    return st;
+  }
+#else
+  (void)n_threads;
+  (void)value_size;
+#endif
+
+  return exess_write_values(datatype,
+                            n_values,
+                            values_size,
+                            values,
+                            offsets,
+                            heap_size,
+                            heap,
+                            grow,
+                            grow_handle);
+}
@@ -1,33 +1,44 @@
-// Copyright 2019-2024 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "read_utils.h"
 
+#include "char_class.h"
 #include "result.h"
 #include "string_utils.h"
 
 #include <exess/exess.h>
 
+#include <stdint.h>
+#include <string.h>
+
 size_t
-skip_whitespace(const char* const str)
+string_length(const size_t len, const char* const str)
 {
-  size_t i = 0;
-  while (is_space(str[i])) {
-    ++i;
+  if (len == SIZE_MAX) {
+    return strlen(str);
   }
 
-  return i;
+  const char* const end = (const char*)memchr(str, '\0', len);
+  return end ? (size_t)(end - str) : len;
+}
+
+size_t
+skip_whitespace(const size_t len, const char* const str)
+{
+  return scan_spaces(len, str);
 }
 
 ExessResult
 read_two_digit_number(uint8_t* const    out,
                       const uint8_t     min_value,
                       const uint8_t     max_value,
+                      const size_t      len,
                       const char* const str)
 {
   // Read digits
   size_t i = 0;
-  for (; i < 2 && is_digit(str[i]); ++i) {
+  for (; i < 2 && i < len && is_digit(str[i]); ++i) {
     *out = (uint8_t)((*out * 10) + (str[i] - '0'));
   }
 
@@ -45,13 +56,14 @@ read_two_digit_number(uint8_t* const    out,
 }
 
 size_t
-read_sign(int* const sign, const char* const str)
+read_sign(int* const sign, const size_t len, const char* const str)
 {
-  if (*str == '-') {
+  const char c = peek(len, str, 0U);
+  if (c == '-') {
     *sign = -1;
     return 1U;
   }
 
   *sign = 1;
-  return (*str == '+') ? 1U : 0U;
+  return (c == '+') ? 1U : 0U;
 }
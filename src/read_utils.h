@@ -1,4 +1,4 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_READ_UTILS_H
@@ -9,19 +9,43 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/**
+   Return the character at index `i`, or null if `i` is past the end.
+
+   Readers take a string with a length, and stop at whichever comes first of
+   the length or a null terminator.  Null-terminated strings are read by
+   passing `SIZE_MAX` as the length.
+*/
+static inline char
+peek(const size_t len, const char* const str, const size_t i)
+{
+  return (i < len) ? str[i] : '\0';
+}
+
+/**
+   Return the length of a string that ends at `len` or a null terminator.
+
+   This is used to bound wide reads, which must not go past the terminator
+   even if `len` is larger, and measures the whole string if `len` is
+   `SIZE_MAX`.
+*/
 EXESS_PURE_FUNC size_t
-skip_whitespace(const char* str);
+string_length(size_t len, const char* str);
+
+EXESS_PURE_FUNC size_t
+skip_whitespace(size_t len, const char* str);
 
 ExessResult
 read_two_digit_number(uint8_t*    out,
                       uint8_t     min_value,
                       uint8_t     max_value,
+                      size_t      len,
                       const char* str);
 
 size_t
-read_sign(int* sign, const char* str);
+read_sign(int* sign, size_t len, const char* str);
 
 ExessResult
-read_digits(uint64_t* out, const char* str);
+read_digits(uint64_t* out, size_t len, const char* str);
 
 #endif // EXESS_SRC_READ_UTILS_H
@@ -0,0 +1,75 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_READ_VALUE_H
+#define EXESS_SRC_READ_VALUE_H
+
+#include <exess/exess.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Readers for every datatype that read at most `len` characters from `str`.
+
+  These stop at the first null character or after `len` characters, whichever
+  comes first, and are otherwise identical to the public exess_read_*()
+  functions which call them with a length of `SIZE_MAX`.
+*/
+
+ExessResult
+read_boolean(bool* out, size_t len, const char* str);
+
+ExessResult
+read_decimal(double* out, size_t len, const char* str);
+
+ExessResult
+read_double(double* out, size_t len, const char* str);
+
+ExessResult
+read_float(float* out, size_t len, const char* str);
+
+ExessResult
+read_long(int64_t* out, size_t len, const char* str);
+
+ExessResult
+read_int(int32_t* out, size_t len, const char* str);
+
+ExessResult
+read_short(int16_t* out, size_t len, const char* str);
+
+ExessResult
+read_byte(int8_t* out, size_t len, const char* str);
+
+ExessResult
+read_ulong(uint64_t* out, size_t len, const char* str);
+
+ExessResult
+read_uint(uint32_t* out, size_t len, const char* str);
+
+ExessResult
+read_ushort(uint16_t* out, size_t len, const char* str);
+
+ExessResult
+read_ubyte(uint8_t* out, size_t len, const char* str);
+
+ExessResult
+read_duration(ExessDuration* out, size_t len, const char* str);
+
+ExessResult
+read_date_time(ExessDateTime* out, size_t len, const char* str);
+
+ExessResult
+read_time(ExessTime* out, size_t len, const char* str);
+
+ExessResult
+read_date(ExessDate* out, size_t len, const char* str);
+
+ExessVariableResult
+read_hex(size_t out_size, void* out, size_t len, const char* str);
+
+ExessVariableResult
+read_base64(size_t out_size, void* out, size_t len, const char* str);
+
+#endif // EXESS_SRC_READ_VALUE_H
@@ -0,0 +1,36 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_SHORTEST_H
+#define EXESS_SRC_SHORTEST_H
+
+#include "digits.h"
+
+/**
+   Write the shortest significant digits that uniquely identify `d` into `buf`.
+
+   This produces exactly the same output as generate_digits() with a
+   `max_digits` of `DBL_DECIMAL_DIG`, but is much faster since it uses only
+   fixed-size integer arithmetic.
+
+   @param d The number to convert to digits, must be finite and positive.
+   @param buf The output buffer at least `DBL_DECIMAL_DIG + 1` long.
+*/
+ExessDigitCount
+generate_shortest_digits(double d, char* buf);
+
+/**
+   Write the significant digits that represent `f` as a float into `buf`.
+
+   This produces exactly the same output as generate_digits() for `f` as a
+   double with a `max_digits` of `FLT_DECIMAL_DIG`.  That is, the shortest
+   digits for the double, truncated to the number of digits needed to uniquely
+   identify a float.
+
+   @param f The number to convert to digits, must be finite and positive.
+   @param buf The output buffer at least `FLT_DECIMAL_DIG + 1` long.
+*/
+ExessDigitCount
+generate_float_digits(float f, char* buf);
+
+#endif // EXESS_SRC_SHORTEST_H
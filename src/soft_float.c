@@ -1,4 +1,4 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "soft_float.h"
@@ -95,21 +95,10 @@ soft_float_normalize(ExessSoftFloat value)
 ExessSoftFloat
 soft_float_multiply(const ExessSoftFloat lhs, const ExessSoftFloat rhs)
 {
-  static const uint64_t mask  = 0xFFFFFFFF;
-  static const uint64_t round = 1UL << 31U;
-
-  const uint64_t l0   = lhs.f >> 32U;
-  const uint64_t l1   = lhs.f & mask;
-  const uint64_t r0   = rhs.f >> 32U;
-  const uint64_t r1   = rhs.f & mask;
-  const uint64_t l0r0 = l0 * r0;
-  const uint64_t l1r0 = l1 * r0;
-  const uint64_t l0r1 = l0 * r1;
-  const uint64_t l1r1 = l1 * r1;
-  const uint64_t mid  = (l1r1 >> 32U) + (l0r1 & mask) + (l1r0 & mask) + round;
-
-  const ExessSoftFloat r = {l0r0 + (l0r1 >> 32U) + (l1r0 >> 32U) + (mid >> 32U),
-                            lhs.e + rhs.e + 64};
+  // Keep the high half of the product, rounded to nearest (halfway up)
+  const ExessUint128 p = exess_umul128(lhs.f, rhs.f);
+
+  const ExessSoftFloat r = {p.hi + (p.lo >> 63U), lhs.e + rhs.e + 64};
 
   return r;
 }
@@ -0,0 +1,237 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "duration.h"
+#include "result.h"
+
+#include <exess/exess.h>
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/// Write the low `n_bytes` of an unsigned integer in big-endian byte order
+static size_t
+write_be(const unsigned n_bytes, const uint64_t value, uint8_t* const key)
+{
+  for (unsigned i = 0U; i < n_bytes; ++i) {
+    key[i] = (uint8_t)(value >> (8U * (n_bytes - 1U - i)));
+  }
+
+  return n_bytes;
+}
+
+/// Write a signed integer with the sign bit flipped so it sorts as unsigned
+static size_t
+write_signed(const unsigned n_bytes, const int64_t value, uint8_t* const key)
+{
+  const uint64_t sign_bit = UINT64_C(1) << ((8U * n_bytes) - 1U);
+
+  return write_be(n_bytes, (uint64_t)value ^ sign_bit, key);
+}
+
+/// Map the representation of a float so that it sorts as an unsigned integer
+static uint64_t
+float_key(const uint64_t rep, const uint64_t sign_bit, const bool is_nan)
+{
+  return is_nan              ? UINT64_MAX // After positive infinity
+         : (rep == sign_bit) ? sign_bit   // Negative zero is zero
+         : (rep & sign_bit)  ? ~rep       // Negative values in reverse
+                             : (rep | sign_bit);
+}
+
+static size_t
+write_double_key(const double value, uint8_t* const key)
+{
+  static const uint64_t sign_bit = UINT64_C(1) << 63U;
+
+  uint64_t rep = 0U;
+  memcpy(&rep, &value, sizeof(rep));
+
+  return write_be(8U, float_key(rep, sign_bit, isnan(value)), key);
+}
+
+static size_t
+write_float_key(const float value, uint8_t* const key)
+{
+  static const uint64_t sign_bit = UINT64_C(1) << 31U;
+
+  uint32_t rep = 0U;
+  memcpy(&rep, &value, sizeof(rep));
+
+  const uint64_t mapped = float_key(rep, sign_bit, isnan(value));
+
+  return write_be(4U, mapped & UINT32_MAX, key);
+}
+
+static size_t
+write_duration_key(const ExessDuration value, uint8_t* const key)
+{
+  // Seconds reached from each reference dateTime in turn, then nanoseconds
+  ExessEpochTime instants[DURATION_N_REFERENCES];
+  duration_instants(value, instants);
+
+  size_t n = 0U;
+  for (unsigned i = 0U; i < DURATION_N_REFERENCES; ++i) {
+    n += write_signed(8U, instants[i].seconds, key + n);
+  }
+
+  return n + write_be(4U, instants[0].nanoseconds, key + n);
+}
+
+static size_t
+write_date_time_key(const ExessDateTime value, uint8_t* const key)
+{
+  // Time since the epoch, then local before zoned values at the same time
+  const ExessEpochTime time = exess_date_time_to_epoch(value);
+
+  write_signed(8U, time.seconds, key);
+  write_be(4U, time.nanoseconds, key + 8U);
+  key[12] = (uint8_t)(value.zone != EXESS_LOCAL);
+  return 13U;
+}
+
+static size_t
+sort_key_size(const ExessDatatype datatype, const size_t value_size)
+{
+  switch (datatype) {
+  case EXESS_NOTHING:
+    break;
+  case EXESS_BOOLEAN:
+  case EXESS_BYTE:
+  case EXESS_UBYTE:
+    return 1U;
+  case EXESS_SHORT:
+  case EXESS_USHORT:
+    return 2U;
+  case EXESS_FLOAT:
+  case EXESS_INT:
+  case EXESS_UINT:
+    return 4U;
+  case EXESS_DECIMAL:
+  case EXESS_DOUBLE:
+  case EXESS_INTEGER:
+  case EXESS_NON_POSITIVE_INTEGER:
+  case EXESS_NEGATIVE_INTEGER:
+  case EXESS_LONG:
+  case EXESS_NON_NEGATIVE_INTEGER:
+  case EXESS_ULONG:
+  case EXESS_POSITIVE_INTEGER:
+    return 8U;
+  case EXESS_DATE_TIME:
+  case EXESS_TIME:
+  case EXESS_DATE:
+    return 13U;
+  case EXESS_DURATION:
+    return 36U;
+  case EXESS_HEX:
+  case EXESS_BASE64:
+    return value_size;
+  }
+
+  return 0U;
+}
+
+ExessResult
+exess_write_sort_key(const ExessDatatype datatype,
+                     const size_t        value_size,
+                     const void* const   value,
+                     const size_t        key_size,
+                     void* const         key)
+{
+  const bool   is_blob = datatype == EXESS_HEX || datatype == EXESS_BASE64;
+  const size_t size    = sort_key_size(datatype, value_size);
+  if (!size && !is_blob) {
+    return result(EXESS_UNSUPPORTED, 0U);
+  }
+
+  const size_t fixed_size = exess_value_size(datatype);
+  if (value_size < fixed_size) {
+    return result(EXESS_BAD_VALUE, 0U);
+  }
+
+  if (!key) {
+    return result(EXESS_SUCCESS, size);
+  }
+
+  if (key_size < size) {
+    return result(EXESS_NO_SPACE, 0U);
+  }
+
+  uint8_t* const k = (uint8_t*)key;
+  switch (datatype) {
+  case EXESS_NOTHING:
+    break;
+  case EXESS_BOOLEAN:
+    k[0] = *(const bool*)value ? 1U : 0U;
+    break;
+  case EXESS_DECIMAL:
+  case EXESS_DOUBLE:
+    write_double_key(*(const double*)value, k);
+    break;
+  case EXESS_FLOAT:
+    write_float_key(*(const float*)value, k);
+    break;
+  case EXESS_INTEGER:
+  case EXESS_NON_POSITIVE_INTEGER:
+  case EXESS_NEGATIVE_INTEGER:
+  case EXESS_LONG:
+    write_signed(8U, *(const int64_t*)value, k);
+    break;
+  case EXESS_INT:
+    write_signed(4U, *(const int32_t*)value, k);
+    break;
+  case EXESS_SHORT:
+    write_signed(2U, *(const int16_t*)value, k);
+    break;
+  case EXESS_BYTE:
+    write_signed(1U, *(const int8_t*)value, k);
+    break;
+  case EXESS_NON_NEGATIVE_INTEGER:
+  case EXESS_ULONG:
+  case EXESS_POSITIVE_INTEGER:
+    write_be(8U, *(const uint64_t*)value, k);
+    break;
+  case EXESS_UINT:
+    write_be(4U, *(const uint32_t*)value, k);
+    break;
+  case EXESS_USHORT:
+    write_be(2U, *(const uint16_t*)value, k);
+    break;
+  case EXESS_UBYTE:
+    k[0] = *(const uint8_t*)value;
+    break;
+  case EXESS_DURATION:
+    write_duration_key(*(const ExessDuration*)value, k);
+    break;
+  case EXESS_DATE_TIME:
+    write_date_time_key(*(const ExessDateTime*)value, k);
+    break;
+  case EXESS_TIME: {
+    // Use the same reference date as exess_compare_time()
+    const ExessTime     t  = *(const ExessTime*)value;
+    const ExessDateTime dt = {
+      1972, 12U, 31U, t.zone, t.hour, t.minute, t.second, t.nanosecond};
+
+    write_date_time_key(dt, k);
+    break;
+  }
+  case EXESS_DATE: {
+    const ExessDate     d  = *(const ExessDate*)value;
+    const ExessDateTime dt = {d.year, d.month, d.day, d.zone, 0U, 0U, 0U, 0U};
+
+    write_date_time_key(dt, k);
+    break;
+  }
+  case EXESS_HEX:
+  case EXESS_BASE64:
+    if (size) {
+      memcpy(k, value, size);
+    }
+    break;
+  }
+
+  return result(EXESS_SUCCESS, size);
+}
@@ -0,0 +1,22 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#include "stats.h"
+
+#include <exess/exess.h>
+
+ExessStats exess_stats_counts = {0U, 0U, 0U, 0U};
+
+ExessStats
+exess_stats(void)
+{
+  return exess_stats_counts;
+}
+
+void
+exess_reset_stats(void)
+{
+  static const ExessStats zero = {0U, 0U, 0U, 0U};
+
+  exess_stats_counts = zero;
+}
@@ -0,0 +1,19 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_SRC_STATS_H
+#define EXESS_SRC_STATS_H
+
+#include <exess/exess.h>
+
+/// Global counts of code paths taken
+extern ExessStats exess_stats_counts;
+
+/// Count that the code path `name` was taken, if enabled
+#if defined(EXESS_STATS) && EXESS_STATS
+#  define EXESS_COUNT(name) (++exess_stats_counts.name)
+#else
+#  define EXESS_COUNT(name)
+#endif
+
+#endif // EXESS_SRC_STATS_H
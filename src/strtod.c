@@ -1,4 +1,4 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "strtod.h"
@@ -6,6 +6,7 @@
 #include <exess/exess.h>
 
 #include "bigint.h"
+#include "eisel_lemire.h"
 #include "floating_decimal.h"
 #include "ieee_float.h"
 #include "int_math.h"
@@ -13,6 +14,7 @@
 #include "read_utils.h"
 #include "result.h"
 #include "soft_float.h"
+#include "stats.h"
 #include "string_utils.h"
 
 #include <assert.h>
@@ -27,15 +29,17 @@ static const int uint64_digits10 = 19;
 
 static size_t
 skip_leading_zeros(ExessFloatingDecimal* const out,
+                   const size_t                len,
                    const char* const           str,
                    bool* const                 after_point)
 {
   *after_point = false;
 
   for (size_t i = 0;; ++i) {
-    if (str[i] == '.' && !*after_point) {
+    const char c = peek(len, str, i);
+    if (c == '.' && !*after_point) {
       *after_point = true;
-    } else if (str[i] == '0') {
+    } else if (c == '0') {
       out->expt -= *after_point;
     } else {
       return i;
@@ -44,31 +48,34 @@ skip_leading_zeros(ExessFloatingDecimal* const out,
 }
 
 ExessResult
-parse_decimal(ExessFloatingDecimal* const out, const char* const str)
+parse_decimal(ExessFloatingDecimal* const out,
+              const size_t                len,
+              const char* const           str)
 {
   // Read leading sign if present
   int    sign = 0;
-  size_t i    = read_sign(&sign, str);
+  size_t i    = read_sign(&sign, len, str);
 
   // Skip any leading zeros (before and after decimal point)
   bool after_point = false;
-  i += skip_leading_zeros(out, &str[i], &after_point);
+  i += skip_leading_zeros(out, len - i, &str[i], &after_point);
 
   // Check that the first character is valid
-  if (!after_point && !is_digit(str[i])) {
+  if (!after_point && !is_digit(peek(len, str, i))) {
     return result(EXESS_EXPECTED_DIGIT, i);
   }
 
   // Read significant digits of the mantissa
   for (;; ++i) {
-    if (is_digit(str[i])) {
+    const char c = peek(len, str, i);
+    if (is_digit(c)) {
       if (out->n_digits < DBL_DECIMAL_DIG + 1) { // Significant digit
         out->expt -= after_point;
-        out->digits[out->n_digits++] = str[i];
+        out->digits[out->n_digits++] = c;
       } else { // Insignificant digit
         out->expt += !after_point;
       }
-    } else if (str[i] == '.' && !after_point) {
+    } else if (c == '.' && !after_point) {
       after_point = true;
     } else {
       break;
@@ -83,7 +90,9 @@ parse_decimal(ExessFloatingDecimal* const out, const char* const str)
 }
 
 ExessResult
-parse_double(ExessFloatingDecimal* const out, const char* const str)
+parse_double(ExessFloatingDecimal* const out,
+             const size_t                len,
+             const char* const           str)
 {
   // Handle non-numeric special cases
 
@@ -102,14 +111,15 @@ parse_double(ExessFloatingDecimal* const out, const char* const str)
   };
 
   for (const SpecialCase* c = special_cases; c->length; ++c) {
-    if (!strcmp(str, c->string)) {
+    if (c->length <= len && !strncmp(str, c->string, c->length) &&
+        !peek(len, str, c->length)) {
       out->kind = c->kind;
       return result(EXESS_SUCCESS, c->length);
     }
   }
 
   // Read mantissa as a decimal
-  const ExessResult r = parse_decimal(out, str);
+  const ExessResult r = parse_decimal(out, len, str);
   if (r.status) {
     return r;
   }
@@ -119,15 +129,15 @@ parse_double(ExessFloatingDecimal* const out, const char* const str)
   // Read exponent
   int abs_expt  = 0;
   int expt_sign = 1;
-  if (str[i] == 'e' || str[i] == 'E') {
+  if (peek(len, str, i) == 'e' || peek(len, str, i) == 'E') {
     ++i;
 
-    if (!is_sign(str[i]) && !is_digit(str[i])) {
+    if (!is_sign(peek(len, str, i)) && !is_digit(peek(len, str, i))) {
       return result(EXESS_EXPECTED_DIGIT, i);
     }
 
-    i += read_sign(&expt_sign, &str[i]);
-    while (is_digit(str[i])) {
+    i += read_sign(&expt_sign, len - i, &str[i]);
+    while (i < len && is_digit(str[i])) {
       abs_expt = (abs_expt * 10) + (str[i++] - '0');
     }
   }
@@ -321,23 +331,34 @@ decimal_to_double(const ExessFloatingDecimal in)
   if (in.n_digits < max_exact_int_digits) {
     if (in.expt < 0) {
       if (-in.expt < n_exact_pow10) {
+        EXESS_COUNT(double_exact);
         return sign * ((double)frac / (double)POW10[-in.expt]);
       }
     } else if (in.expt < n_exact_pow10) {
+      EXESS_COUNT(double_exact);
       return sign * ((double)frac * (double)POW10[in.expt]);
     }
   }
 
-  // Try to guess the number using only soft floating point (fast path)
+  // Try to calculate the number with a 128-bit power of 10 (fast path)
+  double value = 0.0;
+  if (eisel_lemire(frac, in.expt, &value)) {
+    EXESS_COUNT(double_eisel_lemire);
+    return sign * value;
+  }
+
+  // Try to guess the number using only soft floating point
   ExessSoftFloat guess = {0, 0};
   const bool     exact = sftod(frac, in.expt, (int)in.n_digits, &guess);
   const double   g     = soft_float_to_double(guess);
   if (exact) {
+    EXESS_COUNT(double_soft_float);
     return sign * g;
   }
 
   // Not sure, guess is either the number or its predecessor (rare slow path)
   // Compare it with the buffer using bigints to find out which
+  EXESS_COUNT(double_bigint);
   const ExessSoftFloat upper = {(guess.f * 2) + 1, guess.e - 1};
   const int            cmp   = compare_buffer(in.digits, in.expt, upper);
   const bool round_up        = (cmp > 0) || (cmp == 0 && (guess.f & 1U) != 0);
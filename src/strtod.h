@@ -1,4 +1,4 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_STRTOD_H
@@ -8,11 +8,13 @@
 
 #include <exess/exess.h>
 
+#include <stddef.h>
+
 ExessResult
-parse_decimal(ExessFloatingDecimal* out, const char* str);
+parse_decimal(ExessFloatingDecimal* out, size_t len, const char* str);
 
 ExessResult
-parse_double(ExessFloatingDecimal* out, const char* str);
+parse_double(ExessFloatingDecimal* out, size_t len, const char* str);
 
 double
 decimal_to_double(ExessFloatingDecimal in);
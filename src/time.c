@@ -1,7 +1,8 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "string_utils.h"
 #include "time_utils.h"
@@ -29,15 +30,17 @@ exess_compare_time(const ExessTime lhs, const ExessTime rhs)
 }
 
 ExessResult
-read_nanoseconds(uint32_t* const out, const char* const str)
+read_nanoseconds(uint32_t* const   out,
+                 const size_t      len,
+                 const char* const str)
 {
   // Read available digits
   size_t i = 0U;
-  for (; i < 9U && is_digit(str[i]); ++i) {
+  for (; i < 9U && i < len && is_digit(str[i]); ++i) {
     *out = (*out * 10U) + (uint32_t)(str[i] - '0');
   }
 
-  if (i == 9U && is_digit(str[i])) {
+  if (i == 9U && is_digit(peek(len, str, i))) {
     return result(EXESS_OUT_OF_RANGE, i);
   }
 
@@ -50,11 +53,11 @@ read_nanoseconds(uint32_t* const out, const char* const str)
 }
 
 ExessResult
-read_time(ExessTime* const out, const char* const str)
+read_time_numbers(ExessTime* const out, const size_t len, const char* const str)
 {
   // Read hour
   size_t      i = 0;
-  ExessResult r = read_two_digit_number(&out->hour, 0, 24, str + i);
+  ExessResult r = read_two_digit_number(&out->hour, 0, 24, len, str);
   if (r.status) {
     return result(r.status, i + r.count);
   }
@@ -63,35 +66,37 @@ read_time(ExessTime* const out, const char* const str)
 
   // Read hour-minute delimiter
   i += r.count;
-  if (str[i] != ':') {
+  if (peek(len, str, i) != ':') {
     return result(EXESS_EXPECTED_COLON, i);
   }
 
   // Read minute
   ++i;
-  r = read_two_digit_number(&out->minute, 0, midnight ? 0 : 59, str + i);
+  r = read_two_digit_number(
+    &out->minute, 0, midnight ? 0 : 59, len - i, str + i);
   if (r.status) {
     return result(r.status, i + r.count);
   }
 
   // Read minute-second delimiter
   i += r.count;
-  if (str[i] != ':') {
+  if (peek(len, str, i) != ':') {
     return result(EXESS_EXPECTED_COLON, i);
   }
 
   // Read second
   ++i;
-  r = read_two_digit_number(&out->second, 0, midnight ? 0 : 59, str + i);
+  r = read_two_digit_number(
+    &out->second, 0, midnight ? 0 : 59, len - i, str + i);
   i += r.count;
   if (r.status) {
     return result(r.status, i);
   }
 
   // Read nanoseconds if present
-  if (str[i] == '.') {
+  if (peek(len, str, i) == '.') {
     ++i;
-    r = read_nanoseconds(&out->nanosecond, str + i);
+    r = read_nanoseconds(&out->nanosecond, len - i, str + i);
     i += r.count;
   }
   if (r.status) {
@@ -104,19 +109,19 @@ read_time(ExessTime* const out, const char* const str)
   }
 
   // Read timezone offset if present
-  r = read_optional_timezone(&out->zone, str + i);
+  r = read_optional_timezone(&out->zone, len - i, str + i);
   i += r.count;
 
   return result(r.status, i);
 }
 
 ExessResult
-exess_read_time(ExessTime* const out, const char* const str)
+read_time(ExessTime* const out, const size_t len, const char* const str)
 {
   memset(out, 0, sizeof(*out));
 
-  size_t      i = skip_whitespace(str);
-  ExessResult r = read_time(out, str + i);
+  size_t      i = skip_whitespace(len, str);
+  ExessResult r = read_time_numbers(out, len - i, str + i);
 
   if (out->hour == 24) {
     if (out->minute || out->second || out->nanosecond) {
@@ -130,6 +135,12 @@ exess_read_time(ExessTime* const out, const char* const str)
   return r;
 }
 
+ExessResult
+exess_read_time(ExessTime* const out, const char* const str)
+{
+  return read_time(out, SIZE_MAX, str);
+}
+
 size_t
 write_nanoseconds(const uint32_t nanosecond,
                   const size_t   buf_size,
@@ -142,28 +153,25 @@ write_nanoseconds(const uint32_t nanosecond,
     return 0;
   }
 
-  char frac_digits[10] = {'0', '0', '0', '0', '0', '0', '0', '0', '0', 0};
+  // Write all 9 digits as pairs from right to left, then the leading digit
+  char     frac_digits[9] = {0};
+  uint32_t remaining      = nanosecond;
+  for (unsigned j = 9U; j > 1U; j -= 2U) {
+    copy_digit_pair(frac_digits + j - 2U, remaining % 100U);
+    remaining /= 100U;
+  }
 
-  // Write digits right to left, but replace trailing zeros with null
-  uint32_t remaining     = nanosecond;
-  uint32_t n_trailing    = 0;
-  bool     wrote_nonzero = false;
-  for (uint32_t j = 0; remaining > 0; ++j) {
-    const char digit = (char)('0' + (remaining % 10));
-    if (!wrote_nonzero && digit == '0') {
-      frac_digits[8 - j] = '\0';
-      ++n_trailing;
-    } else {
-      frac_digits[8 - j] = digit;
-    }
+  frac_digits[0] = (char)('0' + remaining);
 
-    wrote_nonzero = wrote_nonzero || digit != '0';
-    remaining /= 10;
+  // Omit trailing zeros
+  size_t n_digits = 9U;
+  while (frac_digits[n_digits - 1U] == '0') {
+    --n_digits;
   }
 
   size_t n = write_char('.', buf_size, buf, i);
 
-  n += write_string(9 - n_trailing, frac_digits, buf_size, buf, i + n);
+  n += write_string(n_digits, frac_digits, buf_size, buf, i + n);
 
   return n;
 }
@@ -182,11 +190,17 @@ write_time(const ExessTime value,
   size_t o = offset;
 
   // Write integral hour, minute, and second
-  o += write_two_digit_number(value.hour, buf_size, buf, o);
-  o += write_char(':', buf_size, buf, o);
-  o += write_two_digit_number(value.minute, buf_size, buf, o);
-  o += write_char(':', buf_size, buf, o);
-  o += write_two_digit_number(value.second, buf_size, buf, o);
+  if (buf && buf_size >= o + FIXED_TIME_LENGTH) {
+    write_fixed_time(value, buf + o);
+    o += FIXED_TIME_LENGTH;
+  } else {
+    o += write_two_digit_number(value.hour, buf_size, buf, o);
+    o += write_char(':', buf_size, buf, o);
+    o += write_two_digit_number(value.minute, buf_size, buf, o);
+    o += write_char(':', buf_size, buf, o);
+    o += write_two_digit_number(value.second, buf_size, buf, o);
+  }
+
   o += write_nanoseconds(value.nanosecond, buf_size, buf, o);
 
   const ExessResult r = write_timezone(value.zone, buf_size, buf, o);
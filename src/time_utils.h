@@ -1,17 +1,40 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_TIME_UTILS_H
 #define EXESS_SRC_TIME_UTILS_H
 
+#include "write_utils.h"
+
 #include <exess/exess.h>
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+
+/// Length of a time with only whole seconds and no timezone, like HH:MM:SS
+#define FIXED_TIME_LENGTH 8U
+
+/**
+   Write a time with only whole seconds and no timezone, like HH:MM:SS.
+
+   All fields must be less than 100, and `buf` must have space for
+   #FIXED_TIME_LENGTH characters.  No terminating null is written.
+*/
+static inline void
+write_fixed_time(const ExessTime value, char* const buf)
+{
+  char chars[FIXED_TIME_LENGTH] = {'0', '0', ':', '0', '0', ':'};
+  copy_digit_pair(chars, value.hour);
+  copy_digit_pair(chars + 3U, value.minute);
+  copy_digit_pair(chars + 6U, value.second);
+
+  memcpy(buf, chars, sizeof(chars));
+}
 
 /// Read fractional digits as an integer number of nanoseconds
 ExessResult
-read_nanoseconds(uint32_t* out, const char* str);
+read_nanoseconds(uint32_t* out, size_t len, const char* str);
 
 /// Write nanoseconds as fractional digits
 size_t
@@ -19,7 +42,7 @@ write_nanoseconds(uint32_t nanosecond, size_t buf_size, char* buf, size_t i);
 
 /// Read a time
 ExessResult
-read_time(ExessTime* out, const char* str);
+read_time_numbers(ExessTime* out, size_t len, const char* str);
 
 /// Write a complete time with timezone suffix if necessary
 ExessResult
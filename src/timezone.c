@@ -1,4 +1,4 @@
-// Copyright 2019-2024 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "timezone.h"
@@ -32,22 +32,25 @@ exess_timezone(const int8_t hours, const int8_t minutes)
 }
 
 ExessResult
-read_optional_timezone(ExessTimezone* const out, const char* const str)
+read_optional_timezone(ExessTimezone* const out,
+                       const size_t         len,
+                       const char* const    str)
 {
   *out = EXESS_LOCAL;
 
   // Handle UTC special case
-  size_t i = 0;
-  if (str[i] == 'Z') {
+  size_t     i = 0;
+  const char c = peek(len, str, i);
+  if (c == 'Z') {
     *out = 0;
     return result(EXESS_SUCCESS, i + 1);
   }
 
   // Read leading sign
   int sign = 1;
-  if (str[i] == '-') {
+  if (c == '-') {
     sign = -1;
-  } else if (str[i] != '+') {
+  } else if (c != '+') {
     return result(EXESS_SUCCESS, i);
   }
 
@@ -55,7 +58,7 @@ read_optional_timezone(ExessTimezone* const out, const char* const str)
 
   // Read hour digits
   uint8_t     hh = 0U;
-  ExessResult r  = read_two_digit_number(&hh, 0U, 14U, str + i);
+  ExessResult r  = read_two_digit_number(&hh, 0U, 14U, len - i, str + i);
   if (r.status) {
     return result(r.status, i + r.count);
   }
@@ -63,7 +66,7 @@ read_optional_timezone(ExessTimezone* const out, const char* const str)
   i += 2U;
 
   // Check colon
-  if (str[i] != ':') {
+  if (peek(len, str, i) != ':') {
     return result(EXESS_EXPECTED_COLON, i);
   }
 
@@ -71,7 +74,7 @@ read_optional_timezone(ExessTimezone* const out, const char* const str)
 
   // Read minute digits
   uint8_t mm = 0U;
-  r          = read_two_digit_number(&mm, 0U, 59U, str + i);
+  r          = read_two_digit_number(&mm, 0U, 59U, len - i, str + i);
   if (r.status) {
     return result(r.status, i + r.count);
   }
@@ -1,4 +1,4 @@
-// Copyright 2021 David Robillard <d@drobilla.net>
+// Copyright 2021-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_TIMEZONE_H
@@ -15,11 +15,13 @@
    Read an optional timezone offset suffix.
 
    @param out Set to the parsed value, or false on error.
+   @param len The maximum number of characters to read from `str`.
    @param str String input.
    @return The `count` of characters read, and a `status` code.
 */
 ExessResult
 read_optional_timezone(ExessTimezone* EXESS_NONNULL out,
+                       size_t                       len,
                        const char* EXESS_NONNULL    str);
 
 /**
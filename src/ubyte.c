@@ -1,6 +1,7 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
+#include "read_value.h"
 #include "result.h"
 
 #include <exess/exess.h>
@@ -9,10 +10,10 @@
 #include <stdlib.h>
 
 ExessResult
-exess_read_ubyte(uint8_t* const out, const char* const str)
+read_ubyte(uint8_t* const out, const size_t len, const char* const str)
 {
   uint64_t          long_out = 0;
-  const ExessResult r        = exess_read_ulong(&long_out, str);
+  const ExessResult r        = read_ulong(&long_out, len, str);
   if (r.status) {
     return r;
   }
@@ -25,6 +26,12 @@ exess_read_ubyte(uint8_t* const out, const char* const str)
   return r;
 }
 
+ExessResult
+exess_read_ubyte(uint8_t* const out, const char* const str)
+{
+  return read_ubyte(out, SIZE_MAX, str);
+}
+
 ExessResult
 exess_write_ubyte(const uint8_t value, const size_t buf_size, char* const buf)
 {
@@ -1,70 +1,135 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include <exess/exess.h>
 
 #include "int_math.h"
+#include "macros.h"
 #include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "string_utils.h"
 #include "write_utils.h"
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+/// Number of decimal digits that always fit in a 64-bit unsigned integer
+static const size_t uint64_digits10 = 19U;
+
+/// Return the value of the 8 decimal digit characters starting at `str`
+static inline uint64_t
+parse_eight_digits(const char* const str)
+{
+  // Load as little-endian so the first digit is in the least significant byte
+  uint64_t chunk = 0U;
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && \
+                          __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+  memcpy(&chunk, str, sizeof(chunk));
+#else
+  for (unsigned i = 0U; i < 8U; ++i) {
+    chunk |= (uint64_t)(uint8_t)str[i] << (8U * i);
+  }
+#endif
+
+  static const uint64_t zeros = 0x3030303030303030ULL;
+  static const uint64_t mask  = 0x000000FF000000FFULL;
+  static const uint64_t mul1  = 100U + (1000000ULL << 32U);
+  static const uint64_t mul2  = 1U + (10000ULL << 32U);
+
+  // Convert characters to digits, then combine adjacent digits into the even
+  // bytes (the odd bytes are garbage from here on)
+  chunk -= zeros;
+  chunk = (chunk * 10U) + (chunk >> 8U);
+
+  // Combine pairs of pairs, then those, with the sum in the upper 32 bits
+  return (((chunk & mask) * mul1) + (((chunk >> 16U) & mask) * mul2)) >> 32U;
+}
 
 ExessResult
-read_digits(uint64_t* const out, const char* const str)
+read_digits(uint64_t* const out, const size_t len, const char* const str)
 {
   // Ensure the first character is a digit
   size_t i = 0;
-  if (!is_digit(str[i])) {
+  if (!is_digit(peek(len, str, i))) {
     return result(EXESS_EXPECTED_DIGIT, i);
   }
 
   // Skip leading zeros
-  while (str[i] == '0') {
+  while (i < len && str[i] == '0') {
     ++i;
   }
 
-  // Read digits
-  for (; is_digit(str[i]); ++i) {
-    const uint64_t next = (*out * 10U) + (uint64_t)(str[i] - '0');
-    if (next < *out) {
+  // Find the end of the digits
+  const size_t start = i;
+  while (i < len && is_digit(str[i])) {
+    ++i;
+  }
+
+  // Read as many digits as always fit, 8 at a time and then individually
+  const size_t n_digits = i - start;
+  const size_t safe_end = start + MIN(n_digits, uint64_digits10);
+  uint64_t     value    = 0U;
+  size_t       d        = start;
+  for (; d + 8U <= safe_end; d += 8U) {
+    value = (value * 100000000U) + parse_eight_digits(str + d);
+  }
+
+  for (; d < safe_end; ++d) {
+    value = (value * 10U) + (uint64_t)(str[d] - '0');
+  }
+
+  // Read the next digit (which may not fit) if there is one
+  if (d < i) {
+    const uint64_t digit = (uint64_t)(str[d] - '0');
+    if (value > (UINT64_MAX - digit) / 10U) {
       *out = 0;
-      return result(EXESS_OUT_OF_RANGE, i);
+      return result(EXESS_OUT_OF_RANGE, d);
     }
 
-    *out = next;
+    value = (value * 10U) + digit;
+    if (++d < i) {
+      *out = 0; // Any more digits are definitely too many
+      return result(EXESS_OUT_OF_RANGE, d);
+    }
   }
 
+  *out = value;
   return result(EXESS_SUCCESS, i);
 }
 
 ExessResult
-exess_read_ulong(uint64_t* const out, const char* const str)
+read_ulong(uint64_t* const out, const size_t len, const char* const str)
 {
   *out = 0;
 
   // Skip leading whitespace and read sign if present
-  size_t i    = skip_whitespace(str);
+  size_t i    = skip_whitespace(len, str);
   int    sign = 1;
-  i += read_sign(&sign, &str[i]);
+  i += read_sign(&sign, len - i, &str[i]);
 
   if (sign == -1) {
     size_t j = i;
-    while (str[j] == '0') {
+    while (j < len && str[j] == '0') {
       ++j;
     }
 
     return result((j == i) ? EXESS_EXPECTED_ZERO : EXESS_SUCCESS, j);
   }
 
-  ExessResult r = read_digits(out, str + i);
+  ExessResult r = read_digits(out, len - i, str + i);
 
   r.count += i;
   return r;
 }
 
+ExessResult
+exess_read_ulong(uint64_t* const out, const char* const str)
+{
+  return read_ulong(out, SIZE_MAX, str);
+}
+
 ExessResult
 write_digits(const uint64_t value,
              const size_t   buf_size,
@@ -80,14 +145,21 @@ write_digits(const uint64_t value,
     return end_write(EXESS_NO_SPACE, buf_size, buf, 0);
   }
 
-  // Point s to the end
-  char* s = buf + i + n_digits - 1U;
-
-  // Write integer part (right to left)
+  // Write pairs of digits from right to left
+  char*    s         = buf + i + n_digits;
   uint64_t remaining = value;
-  do {
-    *s-- = (char)('0' + (remaining % 10));
-  } while ((remaining /= 10) > 0);
+  while (remaining >= 100U) {
+    s -= 2;
+    copy_digit_pair(s, (unsigned)(remaining % 100U));
+    remaining /= 100U;
+  }
+
+  // Write the remaining one or two leading digits
+  if (remaining >= 10U) {
+    copy_digit_pair(s - 2, (unsigned)remaining);
+  } else {
+    *(s - 1) = (char)('0' + remaining);
+  }
 
   return result(EXESS_SUCCESS, n_digits);
 }
@@ -95,10 +167,6 @@ write_digits(const uint64_t value,
 ExessResult
 exess_write_ulong(const uint64_t value, const size_t buf_size, char* const buf)
 {
-  if (!buf) {
-    return result(EXESS_SUCCESS, exess_num_digits(value));
-  }
-
   const ExessResult r = write_digits(value, buf_size, buf, 0);
   return end_write(r.status, buf_size, buf, r.count);
 }
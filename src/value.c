@@ -1,6 +1,8 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
+#include "read_utils.h"
+#include "read_value.h"
 #include "result.h"
 #include "write_utils.h"
 
@@ -16,11 +18,42 @@ fixed(const ExessResult result, const size_t write_count)
   return vresult(result.status, result.count, result.status ? 0U : write_count);
 }
 
+static ExessResult
+read_non_positive_integer(int64_t* const    out,
+                          const size_t      len,
+                          const char* const str)
+{
+  const ExessResult r = read_long(out, len, str);
+
+  return (!r.status && *out > 0) ? result(EXESS_OUT_OF_RANGE, r.count) : r;
+}
+
+static ExessResult
+read_negative_integer(int64_t* const    out,
+                      const size_t      len,
+                      const char* const str)
+{
+  const ExessResult r = read_long(out, len, str);
+
+  return (!r.status && *out >= 0) ? result(EXESS_OUT_OF_RANGE, r.count) : r;
+}
+
+static ExessResult
+read_positive_integer(uint64_t* const   out,
+                      const size_t      len,
+                      const char* const str)
+{
+  const ExessResult r = read_ulong(out, len, str);
+
+  return (!r.status && !*out) ? result(EXESS_OUT_OF_RANGE, r.count) : r;
+}
+
 ExessVariableResult
-exess_read_value(const ExessDatatype datatype,
-                 const size_t        out_size,
-                 void* const         out,
-                 const char* const   str)
+exess_read_value_n(const ExessDatatype datatype,
+                   const size_t        out_size,
+                   void* const         out,
+                   const size_t        len,
+                   const char* const   str)
 {
   ExessVariableResult r = {EXESS_UNSUPPORTED, 0, 0};
 
@@ -33,73 +66,200 @@ exess_read_value(const ExessDatatype datatype,
   case EXESS_NOTHING:
     break;
   case EXESS_BOOLEAN:
-    return fixed(exess_read_boolean((bool*)out, str), sizeof(bool));
+    return fixed(read_boolean((bool*)out, len, str), sizeof(bool));
   case EXESS_DECIMAL:
-    return fixed(exess_read_decimal((double*)out, str), sizeof(double));
+    return fixed(read_decimal((double*)out, len, str), sizeof(double));
   case EXESS_DOUBLE:
-    return fixed(exess_read_double((double*)out, str), sizeof(double));
+    return fixed(read_double((double*)out, len, str), sizeof(double));
   case EXESS_FLOAT:
-    return fixed(exess_read_float((float*)out, str), sizeof(float));
+    return fixed(read_float((float*)out, len, str), sizeof(float));
   case EXESS_INTEGER:
-    return fixed(exess_read_long((int64_t*)out, str), sizeof(int64_t));
+    return fixed(read_long((int64_t*)out, len, str), sizeof(int64_t));
 
   case EXESS_NON_POSITIVE_INTEGER:
-    r = fixed(exess_read_long((int64_t*)out, str), sizeof(int64_t));
-    return (!r.status && *(const int64_t*)out > 0)
-             ? vresult(EXESS_OUT_OF_RANGE, r.read_count, 0U)
-             : r;
-
+    return fixed(read_non_positive_integer((int64_t*)out, len, str),
+                 sizeof(int64_t));
   case EXESS_NEGATIVE_INTEGER:
-    r = fixed(exess_read_long((int64_t*)out, str), sizeof(int64_t));
-    return (!r.status && *(const int64_t*)out >= 0)
-             ? vresult(EXESS_OUT_OF_RANGE, r.read_count, 0U)
-             : r;
-
+    return fixed(read_negative_integer((int64_t*)out, len, str),
+                 sizeof(int64_t));
   case EXESS_LONG:
-    return fixed(exess_read_long((int64_t*)out, str), sizeof(int64_t));
+    return fixed(read_long((int64_t*)out, len, str), sizeof(int64_t));
   case EXESS_INT:
-    return fixed(exess_read_int((int32_t*)out, str), sizeof(int32_t));
+    return fixed(read_int((int32_t*)out, len, str), sizeof(int32_t));
   case EXESS_SHORT:
-    return fixed(exess_read_short((int16_t*)out, str), sizeof(int16_t));
+    return fixed(read_short((int16_t*)out, len, str), sizeof(int16_t));
   case EXESS_BYTE:
-    return fixed(exess_read_byte((int8_t*)out, str), sizeof(int8_t));
+    return fixed(read_byte((int8_t*)out, len, str), sizeof(int8_t));
   case EXESS_NON_NEGATIVE_INTEGER:
   case EXESS_ULONG:
-    return fixed(exess_read_ulong((uint64_t*)out, str), sizeof(uint64_t));
+    return fixed(read_ulong((uint64_t*)out, len, str), sizeof(uint64_t));
   case EXESS_UINT:
-    return fixed(exess_read_uint((uint32_t*)out, str), sizeof(uint32_t));
+    return fixed(read_uint((uint32_t*)out, len, str), sizeof(uint32_t));
   case EXESS_USHORT:
-    return fixed(exess_read_ushort((uint16_t*)out, str), sizeof(uint16_t));
+    return fixed(read_ushort((uint16_t*)out, len, str), sizeof(uint16_t));
   case EXESS_UBYTE:
-    return fixed(exess_read_ubyte((uint8_t*)out, str), sizeof(uint8_t));
-
+    return fixed(read_ubyte((uint8_t*)out, len, str), sizeof(uint8_t));
   case EXESS_POSITIVE_INTEGER:
-    r = fixed(exess_read_ulong((uint64_t*)out, str), sizeof(uint64_t));
-    return (!r.status && *(const uint64_t*)out == 0)
-             ? vresult(EXESS_OUT_OF_RANGE, r.read_count, 0U)
-             : r;
+    return fixed(read_positive_integer((uint64_t*)out, len, str),
+                 sizeof(uint64_t));
 
   case EXESS_DURATION:
-    return fixed(exess_read_duration((ExessDuration*)out, str),
+    return fixed(read_duration((ExessDuration*)out, len, str),
                  sizeof(ExessDuration));
 
   case EXESS_DATE_TIME:
-    return fixed(exess_read_date_time((ExessDateTime*)out, str),
+    return fixed(read_date_time((ExessDateTime*)out, len, str),
                  sizeof(ExessDateTime));
 
   case EXESS_TIME:
-    return fixed(exess_read_time((ExessTime*)out, str), sizeof(ExessTime));
+    return fixed(read_time((ExessTime*)out, len, str), sizeof(ExessTime));
   case EXESS_DATE:
-    return fixed(exess_read_date((ExessDate*)out, str), sizeof(ExessDate));
+    return fixed(read_date((ExessDate*)out, len, str), sizeof(ExessDate));
   case EXESS_HEX:
-    return exess_read_hex(out_size, out, str);
+    return read_hex(out_size, out, len, str);
   case EXESS_BASE64:
-    return exess_read_base64(out_size, out, str);
+    return read_base64(out_size, out, len, str);
   }
 
   return r;
 }
 
+ExessVariableResult
+exess_read_value(const ExessDatatype datatype,
+                 const size_t        out_size,
+                 void* const         out,
+                 const char* const   str)
+{
+  return exess_read_value_n(datatype, out_size, out, SIZE_MAX, str);
+}
+
+/// Return the status of reading a value that should span the whole string
+static inline ExessStatus
+whole_status(const ExessResult r, const ExessStringView string)
+{
+  if (r.status) {
+    return r.status;
+  }
+
+  const size_t end =
+    r.count + skip_whitespace(string.length - r.count, string.data + r.count);
+
+  return (end == string.length) ? EXESS_SUCCESS : EXESS_BAD_VALUE;
+}
+
+/// Set the status of an item in a batch and return the overall status
+static inline ExessStatus
+set_status(ExessStatus* const statuses,
+           const size_t       index,
+           const ExessStatus  first_status,
+           const ExessStatus  status)
+{
+  if (statuses) {
+    statuses[index] = status;
+  }
+
+  return first_status ? first_status : status;
+}
+
+/// Read every string in a batch with the reader for a fixed-size value type
+#define READ_VALUES(Type, read)                                        \
+  do {                                                                 \
+    Type* const values = (Type*)out;                                   \
+    for (size_t i = 0U; i < n_values; ++i) {                           \
+      const ExessStringView s = strings[i];                            \
+      const ExessResult     r = read(&values[i], s.length, s.data);    \
+      st = set_status(statuses, i, st, whole_status(r, s));            \
+    }                                                                  \
+  } while (0)
+
+ExessStatus
+exess_read_values(const ExessDatatype          datatype,
+                  const size_t                 n_values,
+                  const ExessStringView* const strings,
+                  const size_t                 out_size,
+                  void* const                  out,
+                  ExessStatus* const           statuses)
+{
+  const size_t value_size = exess_value_size(datatype);
+  if (!value_size) {
+    return EXESS_UNSUPPORTED;
+  }
+
+  if (out_size / value_size < n_values) {
+    return EXESS_NO_SPACE;
+  }
+
+  ExessStatus st = EXESS_SUCCESS;
+  switch (datatype) {
+  case EXESS_NOTHING:
+    break;
+  case EXESS_BOOLEAN:
+    READ_VALUES(bool, read_boolean);
+    break;
+  case EXESS_DECIMAL:
+    READ_VALUES(double, read_decimal);
+    break;
+  case EXESS_DOUBLE:
+    READ_VALUES(double, read_double);
+    break;
+  case EXESS_FLOAT:
+    READ_VALUES(float, read_float);
+    break;
+  case EXESS_INTEGER:
+  case EXESS_LONG:
+    READ_VALUES(int64_t, read_long);
+    break;
+  case EXESS_NON_POSITIVE_INTEGER:
+    READ_VALUES(int64_t, read_non_positive_integer);
+    break;
+  case EXESS_NEGATIVE_INTEGER:
+    READ_VALUES(int64_t, read_negative_integer);
+    break;
+  case EXESS_INT:
+    READ_VALUES(int32_t, read_int);
+    break;
+  case EXESS_SHORT:
+    READ_VALUES(int16_t, read_short);
+    break;
+  case EXESS_BYTE:
+    READ_VALUES(int8_t, read_byte);
+    break;
+  case EXESS_NON_NEGATIVE_INTEGER:
+  case EXESS_ULONG:
+    READ_VALUES(uint64_t, read_ulong);
+    break;
+  case EXESS_UINT:
+    READ_VALUES(uint32_t, read_uint);
+    break;
+  case EXESS_USHORT:
+    READ_VALUES(uint16_t, read_ushort);
+    break;
+  case EXESS_UBYTE:
+    READ_VALUES(uint8_t, read_ubyte);
+    break;
+  case EXESS_POSITIVE_INTEGER:
+    READ_VALUES(uint64_t, read_positive_integer);
+    break;
+  case EXESS_DURATION:
+    READ_VALUES(ExessDuration, read_duration);
+    break;
+  case EXESS_DATE_TIME:
+    READ_VALUES(ExessDateTime, read_date_time);
+    break;
+  case EXESS_TIME:
+    READ_VALUES(ExessTime, read_time);
+    break;
+  case EXESS_DATE:
+    READ_VALUES(ExessDate, read_date);
+    break;
+  case EXESS_HEX:
+  case EXESS_BASE64:
+    break;
+  }
+
+  return st;
+}
+
 ExessResult
 exess_write_value(const ExessDatatype datatype,
                   const size_t        value_size,
@@ -160,3 +320,140 @@ exess_write_value(const ExessDatatype datatype,
 
   return end_write(EXESS_BAD_VALUE, buf_size, buf, 0);
 }
+
+/// Grow the heap to at least `min_size` bytes
+static ExessStatus
+grow_heap(const ExessGrowFunc grow,
+          void* const         grow_handle,
+          const size_t        min_size,
+          size_t* const       heap_size,
+          char** const        heap)
+{
+  size_t      new_size = *heap_size;
+  char* const new_heap =
+    grow ? grow(grow_handle, min_size, &new_size, *heap) : NULL;
+
+  if (!new_heap) {
+    return EXESS_NO_SPACE;
+  }
+
+  *heap_size = new_size;
+  *heap      = new_heap;
+  return (new_size < min_size) ? EXESS_NO_SPACE : EXESS_SUCCESS;
+}
+
+/// Write every value in a batch with the writer for a fixed-size value type
+#define WRITE_VALUES(Type, write)                                        \
+  do {                                                                   \
+    const Type* const typed = (const Type*)values;                       \
+    for (size_t i = 0U; i < n_values; ++i) {                             \
+      offsets[i] = o;                                                    \
+                                                                         \
+      ExessResult r = {EXESS_NO_SPACE, 0U};                              \
+      if (*heap) {                                                       \
+        r = write(typed[i], *heap_size - o, *heap + o);                  \
+      }                                                                  \
+                                                                         \
+      if (r.status == EXESS_NO_SPACE) {                                  \
+        r = write(typed[i], 0U, NULL);                                   \
+        if (!r.status) {                                                 \
+          const size_t min_size = o + r.count + 1U;                      \
+          if (grow_heap(grow, grow_handle, min_size, heap_size, heap)) { \
+            return EXESS_NO_SPACE;                                       \
+          }                                                              \
+                                                                         \
+          r = write(typed[i], *heap_size - o, *heap + o);                \
+        }                                                                \
+      }                                                                  \
+                                                                         \
+      st = st ? st : r.status;                                           \
+      o += r.status ? 0U : r.count;                                      \
+    }                                                                    \
+  } while (0)
+
+ExessStatus
+exess_write_values(const ExessDatatype datatype,
+                   const size_t        n_values,
+                   const size_t        values_size,
+                   const void* const   values,
+                   size_t* const       offsets,
+                   size_t* const       heap_size,
+                   char** const        heap,
+                   const ExessGrowFunc grow,
+                   void* const         grow_handle)
+{
+  const size_t value_size = exess_value_size(datatype);
+  if (!value_size) {
+    return EXESS_UNSUPPORTED;
+  }
+
+  if (values_size / value_size < n_values) {
+    return EXESS_BAD_VALUE;
+  }
+
+  ExessStatus st = EXESS_SUCCESS;
+  size_t      o  = 0U;
+  switch (datatype) {
+  case EXESS_NOTHING:
+    break;
+  case EXESS_BOOLEAN:
+    WRITE_VALUES(bool, exess_write_boolean);
+    break;
+  case EXESS_DECIMAL:
+    WRITE_VALUES(double, exess_write_decimal);
+    break;
+  case EXESS_DOUBLE:
+    WRITE_VALUES(double, exess_write_double);
+    break;
+  case EXESS_FLOAT:
+    WRITE_VALUES(float, exess_write_float);
+    break;
+  case EXESS_INTEGER:
+  case EXESS_NON_POSITIVE_INTEGER:
+  case EXESS_NEGATIVE_INTEGER:
+  case EXESS_LONG:
+    WRITE_VALUES(int64_t, exess_write_long);
+    break;
+  case EXESS_INT:
+    WRITE_VALUES(int32_t, exess_write_int);
+    break;
+  case EXESS_SHORT:
+    WRITE_VALUES(int16_t, exess_write_short);
+    break;
+  case EXESS_BYTE:
+    WRITE_VALUES(int8_t, exess_write_byte);
+    break;
+  case EXESS_NON_NEGATIVE_INTEGER:
+  case EXESS_ULONG:
+  case EXESS_POSITIVE_INTEGER:
+    WRITE_VALUES(uint64_t, exess_write_ulong);
+    break;
+  case EXESS_UINT:
+    WRITE_VALUES(uint32_t, exess_write_uint);
+    break;
+  case EXESS_USHORT:
+    WRITE_VALUES(uint16_t, exess_write_ushort);
+    break;
+  case EXESS_UBYTE:
+    WRITE_VALUES(uint8_t, exess_write_ubyte);
+    break;
+  case EXESS_DURATION:
+    WRITE_VALUES(ExessDuration, exess_write_duration);
+    break;
+  case EXESS_DATE_TIME:
+    WRITE_VALUES(ExessDateTime, exess_write_date_time);
+    break;
+  case EXESS_TIME:
+    WRITE_VALUES(ExessTime, exess_write_time);
+    break;
+  case EXESS_DATE:
+    WRITE_VALUES(ExessDate, exess_write_date);
+    break;
+  case EXESS_HEX:
+  case EXESS_BASE64:
+    break;
+  }
+
+  offsets[n_values] = o;
+  return st;
+}
@@ -1,4 +1,4 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "write_utils.h"
@@ -62,9 +62,8 @@ write_two_digit_number(const uint8_t value,
                        char* const   buf,
                        const size_t  i)
 {
-  if (buf_size >= i + 1) {
-    buf[i]     = (char)((value >= 10) ? ('0' + (value / 10)) : '0');
-    buf[i + 1] = (char)('0' + (value % 10));
+  if (buf && buf_size >= i + 2) {
+    copy_digit_pair(buf + i, value % 100U);
   }
 
   return 2;
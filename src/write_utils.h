@@ -1,4 +1,4 @@
-// Copyright 2019-2021 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_WRITE_UTILS_H
@@ -8,6 +8,27 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+
+/// Pairs of digit characters for every number from 00 to 99
+static const char DIGIT_PAIRS[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+/// Copy the two digit characters for `value`, which must be less than 100
+static inline void
+copy_digit_pair(char* const dst, const unsigned value)
+{
+  memcpy(dst, &DIGIT_PAIRS[2U * value], 2U);
+}
 
 size_t
 write_char(char c, size_t buf_size, char* buf, size_t i);
@@ -1,4 +1,4 @@
-// Copyright 2019-2025 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #include "year.h"
@@ -15,21 +15,21 @@
 #include <stdlib.h>
 
 ExessResult
-read_year_number(int16_t* const out, const char* const str)
+read_year_number(int16_t* const out, const size_t len, const char* const str)
 {
   *out = 0;
 
   // Read leading sign if present
   size_t i    = 0;
   int    sign = 1;
-  if (str[i] == '-') {
+  if (peek(len, str, i) == '-') {
     sign = -1;
     ++i;
   }
 
   // Read digits
   uint64_t          magnitude = 0;
-  const ExessResult r         = read_digits(&magnitude, str + i);
+  const ExessResult r         = read_digits(&magnitude, len - i, str + i);
 
   i += r.count;
   if (r.status) {
@@ -80,7 +80,7 @@ write_year_number(const int16_t value, const size_t buf_size, char* const buf)
     i += write_char('0', buf_size, buf, i);
   }
 
-  const ExessResult yr = exess_write_uint(abs_year, buf_size - i, buf + i);
+  const ExessResult yr = write_digits(abs_year, buf_size, buf, i);
 
   return end_write(yr.status, buf_size, buf, i + yr.count);
 }
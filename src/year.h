@@ -1,4 +1,4 @@
-// Copyright 2019-2023 David Robillard <d@drobilla.net>
+// Copyright 2019-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #ifndef EXESS_SRC_YEAR_H
@@ -10,7 +10,7 @@
 #include <stdint.h>
 
 ExessResult
-read_year_number(int16_t* out, const char* str);
+read_year_number(int16_t* out, size_t len, const char* str);
 
 ExessResult
 write_year_number(int16_t value, size_t buf_size, char* buf);
@@ -0,0 +1,166 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+// Benchmark for the exact bigint paths of generating and parsing digits
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "../src/digits.h"
+
+#include "bench_utils.h"
+#include "int_test_utils.h"
+
+#include <exess/exess.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// Maximum length of a generated number string
+#define MAX_STRING_LENGTH 24U
+
+static double
+double_from_rep(const uint64_t rep)
+{
+  double value = 0.0;
+  memcpy(&value, &rep, sizeof(double));
+  return value;
+}
+
+/// Return the fastest time of several runs of generating digits for `values`
+static double
+time_generate_digits(const size_t        n_values,
+                     const double* const values,
+                     const unsigned      n_runs,
+                     size_t* const       checksum)
+{
+  char   buf[MAX_STRING_LENGTH] = {0};
+  double best                   = 0.0;
+
+  for (unsigned run = 0U; run < n_runs; ++run) {
+    const double t0 = bench_now();
+    for (size_t i = 0U; i < n_values; ++i) {
+      *checksum += generate_digits(values[i], 17U, buf).count;
+    }
+
+    const double t = bench_now() - t0;
+    best           = (!run || t < best) ? t : best;
+  }
+
+  return best;
+}
+
+/// Return the fastest time of several runs of reading every string
+static double
+time_read_double(const size_t      n_values,
+                 const char* const strings,
+                 const unsigned    n_runs,
+                 size_t* const     checksum)
+{
+  double best = 0.0;
+
+  for (unsigned run = 0U; run < n_runs; ++run) {
+    const double t0 = bench_now();
+    for (size_t i = 0U; i < n_values; ++i) {
+      double value = 0.0;
+
+      const ExessResult r =
+        exess_read_double(&value, strings + (i * MAX_STRING_LENGTH));
+
+      *checksum += r.count + (value > 0.0);
+    }
+
+    const double t = bench_now() - t0;
+    best           = (!run || t < best) ? t : best;
+  }
+
+  return best;
+}
+
+static int
+print_usage(const char* const name)
+{
+  fprintf(stderr, "Usage: %s [OPTION]...\n", name);
+  fprintf(stderr,
+          "Run bigint benchmarks and print results as JSON.\n\n"
+          "  -n NUM_VALUES  Number of values for each benchmark\n"
+          "  -r NUM_RUNS    Number of runs (the fastest is reported)\n");
+  return 1;
+}
+
+int
+main(int argc, char** argv)
+{
+  size_t   n_values = 100000U;
+  unsigned n_runs   = 5U;
+
+  for (int a = 1; a < argc; ++a) {
+    if (argv[a][0] != '-' || a + 1 >= argc) {
+      return print_usage(argv[0]);
+    }
+
+    if (argv[a][1] == 'n') {
+      n_values = strtoul(argv[++a], NULL, 10);
+    } else if (argv[a][1] == 'r') {
+      n_runs = (unsigned)strtoul(argv[++a], NULL, 10);
+    } else {
+      return print_usage(argv[0]);
+    }
+  }
+
+  if (!n_values || !n_runs) {
+    return print_usage(argv[0]);
+  }
+
+  double* const values  = (double*)calloc(n_values, sizeof(double));
+  char* const   strings = (char*)calloc(n_values, MAX_STRING_LENGTH);
+  if (!values || !strings) {
+    free(strings);
+    free(values);
+    return 1;
+  }
+
+  uint64_t rng = 1U;
+  for (size_t i = 0U; i < n_values; ++i) {
+    // Any positive finite double (with an exponent that isn't all ones)
+    do {
+      rng = lcg64(rng);
+    } while (((rng >> 52U) & 0x7FFU) == 0x7FFU || !(rng << 1U));
+
+    values[i] = double_from_rep(rng & ~(UINT64_C(1) << 63U));
+
+    /* An integer exactly halfway between two doubles that rounds down to an
+       even significand, which is only resolved by comparing bigints */
+    rng = lcg64(rng);
+
+    const uint64_t significand =
+      (UINT64_C(1) << 52U) | ((rng >> 12U) & ~UINT64_C(1));
+    const unsigned shift   = (unsigned)(rng >> 62U);
+    const uint64_t halfway = ((2U * significand) + 1U) << shift;
+
+    snprintf(strings + (i * MAX_STRING_LENGTH),
+             MAX_STRING_LENGTH,
+             "%llu",
+             (unsigned long long)halfway);
+  }
+
+  size_t       checksum = 0U;
+  const double gen_time =
+    time_generate_digits(n_values, values, n_runs, &checksum);
+  const double read_time =
+    time_read_double(n_values, strings, n_runs, &checksum);
+
+  printf("{\n  \"n_values\": %zu,\n  \"n_runs\": %u,\n", n_values, n_runs);
+  printf("  \"checksum\": %zu,\n", checksum);
+  printf("  \"benchmarks\": [\n");
+  printf("    {\"name\": \"generate_digits\", \"ns_per_op\": %.3f},\n",
+         gen_time * 1e9 / (double)n_values);
+  printf("    {\"name\": \"compare_buffer\", \"ns_per_op\": %.3f}\n",
+         read_time * 1e9 / (double)n_values);
+  printf("  ]\n}\n");
+
+  free(strings);
+  free(values);
+  return 0;
+}
@@ -0,0 +1,382 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+// Benchmark for reading and writing every datatype, with JSON output
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench_utils.h"
+#include "int_test_utils.h"
+
+#include <exess/exess.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// Function that generates a random value from an RNG state
+typedef void (*GenerateFunc)(uint64_t* rng, void* value);
+
+/// A benchmark for reading and writing random values of a datatype
+typedef struct {
+  const char*   name;       ///< Unique name of benchmark
+  ExessDatatype datatype;   ///< Datatype of values
+  size_t        value_size; ///< Size of a value in bytes
+  GenerateFunc  generate;   ///< Random value generator
+} BenchCase;
+
+/// Measured time for a benchmark operation
+typedef struct {
+  double seconds; ///< Fastest total time of all values
+  size_t n_bytes; ///< Total number of string bytes (without terminators)
+} Timing;
+
+static uint64_t
+next(uint64_t* const rng)
+{
+  return (*rng = lcg64(*rng));
+}
+
+static double
+double_from_rep(const uint64_t rep)
+{
+  double value = 0.0;
+  memcpy(&value, &rep, sizeof(double));
+  return value;
+}
+
+static void
+generate_boolean(uint64_t* const rng, void* const value)
+{
+  *(bool*)value = (next(rng) >> 32U) & 1U;
+}
+
+static void
+generate_short_long(uint64_t* const rng, void* const value)
+{
+  *(int64_t*)value = (int64_t)((next(rng) >> 32U) % 20001U) - 10000;
+}
+
+static void
+generate_long(uint64_t* const rng, void* const value)
+{
+  *(int64_t*)value = (int64_t)next(rng);
+}
+
+static void
+generate_short_double(uint64_t* const rng, void* const value)
+{
+  // Quarters in [-2500, 2500] like "1.25E1"
+  *(double*)value = (double)((int64_t)((next(rng) >> 32U) % 20001U) - 10000) /
+                    4.0;
+}
+
+static void
+generate_double(uint64_t* const rng, void* const value)
+{
+  // Any finite double (which has an exponent that isn't all ones)
+  uint64_t rep = next(rng);
+  while (((rep >> 52U) & 0x7FFU) == 0x7FFU) {
+    rep = next(rng);
+  }
+
+  *(double*)value = double_from_rep(rep);
+}
+
+static void
+generate_subnormal_double(uint64_t* const rng, void* const value)
+{
+  // Clear the exponent to get a subnormal (or zero) with a random sign
+  const uint64_t rep = next(rng) & ~(UINT64_C(0x7FF) << 52U);
+
+  *(double*)value = double_from_rep(rep);
+}
+
+static void
+generate_float(uint64_t* const rng, void* const value)
+{
+  // Any finite float (which has an exponent that isn't all ones)
+  uint32_t rep = (uint32_t)(next(rng) >> 32U);
+  while (((rep >> 23U) & 0xFFU) == 0xFFU) {
+    rep = (uint32_t)(next(rng) >> 32U);
+  }
+
+  memcpy(value, &rep, sizeof(float));
+}
+
+static void
+generate_decimal(uint64_t* const rng, void* const value)
+{
+  // Full-precision mantissa with an exponent in about [1e-18, 1e18]
+  const uint64_t bits     = next(rng);
+  const uint64_t exponent = 1023U - 60U + ((bits >> 52U) % 121U);
+  const uint64_t rep =
+    (bits & UINT64_C(0x800FFFFFFFFFFFFF)) | (exponent << 52U);
+
+  *(double*)value = double_from_rep(rep);
+}
+
+static void
+generate_duration(uint64_t* const rng, void* const value)
+{
+  // Fields must all have the same sign, so negate them all sometimes
+  const uint64_t bits = next(rng);
+  const int32_t  sign = (bits & 1U) ? -1 : 1;
+
+  ExessDuration* const duration = (ExessDuration*)value;
+  duration->months              = sign * (int32_t)((bits >> 8U) % 1200U);
+  duration->seconds             = sign * (int32_t)((bits >> 20U) % 2592000U);
+  duration->nanoseconds =
+    ((bits >> 1U) & 1U) ? sign * (int32_t)(next(rng) % 1000000000U) : 0;
+}
+
+static void
+generate_date_time(uint64_t* const      rng,
+                   ExessDateTime* const date_time,
+                   const bool           zoned)
+{
+  const uint64_t bits = next(rng);
+
+  date_time->year   = (int16_t)(1900U + ((bits >> 8U) % 200U));
+  date_time->month  = (uint8_t)(1U + ((bits >> 16U) % 12U));
+  date_time->day    = (uint8_t)(1U + ((bits >> 24U) % 28U));
+  date_time->hour   = (uint8_t)((bits >> 32U) % 24U);
+  date_time->minute = (uint8_t)((bits >> 40U) % 60U);
+  date_time->second = (uint8_t)((bits >> 48U) % 60U);
+  date_time->nanosecond =
+    (bits & 1U) ? (uint32_t)(next(rng) % 1000000000U) : 0U;
+
+  // Offsets in quarter hours in [-14:00, 14:00]
+  date_time->zone =
+    zoned ? (ExessTimezone)((int)((bits >> 56U) % 113U) - 56) : EXESS_LOCAL;
+}
+
+static void
+generate_zoned_date_time(uint64_t* const rng, void* const value)
+{
+  generate_date_time(rng, (ExessDateTime*)value, true);
+}
+
+static void
+generate_local_date_time(uint64_t* const rng, void* const value)
+{
+  generate_date_time(rng, (ExessDateTime*)value, false);
+}
+
+static void
+generate_blob(uint64_t* const rng, void* const value, const size_t size)
+{
+  uint8_t* const bytes = (uint8_t*)value;
+  for (size_t i = 0U; i < size; ++i) {
+    bytes[i] = (uint8_t)(next(rng) >> 56U);
+  }
+}
+
+static void
+generate_short_blob(uint64_t* const rng, void* const value)
+{
+  generate_blob(rng, value, 16U);
+}
+
+static void
+generate_long_blob(uint64_t* const rng, void* const value)
+{
+  generate_blob(rng, value, 1024U);
+}
+
+static const BenchCase cases[] = {
+  {"boolean", EXESS_BOOLEAN, sizeof(bool), generate_boolean},
+  {"decimal_long", EXESS_DECIMAL, sizeof(double), generate_decimal},
+  {"double_short", EXESS_DOUBLE, sizeof(double), generate_short_double},
+  {"double_long", EXESS_DOUBLE, sizeof(double), generate_double},
+  {"double_subnormal",
+   EXESS_DOUBLE,
+   sizeof(double),
+   generate_subnormal_double},
+  {"float_long", EXESS_FLOAT, sizeof(float), generate_float},
+  {"long_short", EXESS_LONG, sizeof(int64_t), generate_short_long},
+  {"long_long", EXESS_LONG, sizeof(int64_t), generate_long},
+  {"duration", EXESS_DURATION, sizeof(ExessDuration), generate_duration},
+  {"date_time_zoned",
+   EXESS_DATE_TIME,
+   sizeof(ExessDateTime),
+   generate_zoned_date_time},
+  {"date_time_local",
+   EXESS_DATE_TIME,
+   sizeof(ExessDateTime),
+   generate_local_date_time},
+  {"hex_short", EXESS_HEX, 16U, generate_short_blob},
+  {"hex_long", EXESS_HEX, 1024U, generate_long_blob},
+  {"base64_short", EXESS_BASE64, 16U, generate_short_blob},
+  {"base64_long", EXESS_BASE64, 1024U, generate_long_blob},
+};
+
+// Print a result, preceded by a separator if it isn't the first
+static void
+print_result(const BenchCase* const bench,
+             const char* const      operation,
+             const size_t           n_values,
+             const Timing           timing,
+             size_t* const          n_results)
+{
+  const double ns_per_op = timing.seconds * 1e9 / (double)n_values;
+  const double mb_per_s  = (double)timing.n_bytes / timing.seconds / 1e6;
+
+  printf("%s    {\"name\": \"%s\", \"datatype\": \"%s\", "
+         "\"operation\": \"%s\", \"ns_per_op\": %.3f, \"mb_per_s\": %.3f}",
+         (*n_results)++ ? ",\n" : "",
+         bench->name,
+         exess_datatype_name(bench->datatype),
+         operation,
+         ns_per_op,
+         mb_per_s);
+}
+
+static int
+run_case(const BenchCase* const bench,
+         const size_t           n_values,
+         const unsigned         n_runs,
+         size_t* const          n_results)
+{
+  const ExessDatatype datatype   = bench->datatype;
+  const size_t        value_size = bench->value_size;
+
+  char* const   values  = (char*)calloc(n_values, value_size);
+  char* const   out     = (char*)calloc(n_values, value_size);
+  size_t* const offsets = (size_t*)calloc(n_values + 1U, sizeof(size_t));
+  if (!values || !out || !offsets) {
+    return 1;
+  }
+
+  // Generate values and lay out a heap for their null-terminated strings
+  uint64_t rng = 1U;
+  for (size_t i = 0U; i < n_values; ++i) {
+    char* const value = values + (i * value_size);
+    bench->generate(&rng, value);
+
+    const ExessResult r =
+      exess_write_value(datatype, value_size, value, 0U, NULL);
+    if (r.status) {
+      fprintf(stderr, "error: %s: %s\n", bench->name, exess_strerror(r.status));
+      return 1;
+    }
+
+    offsets[i + 1U] = offsets[i] + r.count + 1U;
+  }
+
+  char* const heap = (char*)calloc(offsets[n_values], 1U);
+  if (!heap) {
+    return 1;
+  }
+
+  Timing write_timing = {0.0, offsets[n_values] - n_values};
+  Timing read_timing  = {0.0, offsets[n_values] - n_values};
+  size_t n_errors     = 0U;
+  for (unsigned run = 0U; run < n_runs; ++run) {
+    // Write every value
+    const double t0 = bench_now();
+    for (size_t i = 0U; i < n_values; ++i) {
+      const ExessResult w = exess_write_value(datatype,
+                                              value_size,
+                                              values + (i * value_size),
+                                              offsets[i + 1U] - offsets[i],
+                                              heap + offsets[i]);
+
+      n_errors += w.status != EXESS_SUCCESS;
+    }
+
+    // Read every string back
+    const double t1 = bench_now();
+    for (size_t i = 0U; i < n_values; ++i) {
+      const ExessVariableResult r = exess_read_value(
+        datatype, value_size, out + (i * value_size), heap + offsets[i]);
+
+      n_errors += r.status != EXESS_SUCCESS;
+    }
+
+    // Keep the fastest time of all runs
+    const double t2 = bench_now();
+    if (!run || t1 - t0 < write_timing.seconds) {
+      write_timing.seconds = t1 - t0;
+    }
+    if (!run || t2 - t1 < read_timing.seconds) {
+      read_timing.seconds = t2 - t1;
+    }
+  }
+
+  if (n_errors) {
+    fprintf(stderr, "error: %s: failed to round-trip\n", bench->name);
+  } else {
+    print_result(bench, "write", n_values, write_timing, n_results);
+    print_result(bench, "read", n_values, read_timing, n_results);
+  }
+
+  free(heap);
+  free(offsets);
+  free(out);
+  free(values);
+  return n_errors ? 1 : 0;
+}
+
+static int
+print_usage(const char* const name)
+{
+  fprintf(stderr, "Usage: %s [OPTION]... [NAME]...\n", name);
+  fprintf(stderr,
+          "Run benchmarks (all by default) and print results as JSON.\n\n"
+          "  -n NUM_VALUES  Number of values for each benchmark\n"
+          "  -r NUM_RUNS    Number of runs (the fastest is reported)\n");
+  return 1;
+}
+
+int
+main(int argc, char** argv)
+{
+  size_t   n_values = 100000U;
+  unsigned n_runs   = 5U;
+
+  int a = 1;
+  for (; a < argc && argv[a][0] == '-'; ++a) {
+    if (a + 1 >= argc) {
+      return print_usage(argv[0]);
+    }
+
+    if (argv[a][1] == 'n') {
+      n_values = strtoul(argv[++a], NULL, 10);
+    } else if (argv[a][1] == 'r') {
+      n_runs = (unsigned)strtoul(argv[++a], NULL, 10);
+    } else {
+      return print_usage(argv[0]);
+    }
+  }
+
+  if (!n_values || !n_runs) {
+    return print_usage(argv[0]);
+  }
+
+  // Select benchmarks by name if any are given
+  const size_t n_cases = sizeof(cases) / sizeof(BenchCase);
+  bool         selected[sizeof(cases) / sizeof(BenchCase)];
+  for (size_t c = 0U; c < n_cases; ++c) {
+    selected[c] = a == argc;
+    for (int i = a; i < argc; ++i) {
+      selected[c] = selected[c] || !strcmp(argv[i], cases[c].name);
+    }
+  }
+
+  printf("{\n  \"n_values\": %zu,\n  \"n_runs\": %u,\n", n_values, n_runs);
+  printf("  \"benchmarks\": [\n");
+
+  int    st        = 0;
+  size_t n_results = 0U;
+  for (size_t c = 0U; c < n_cases; ++c) {
+    if (selected[c]) {
+      st |= run_case(&cases[c], n_values, n_runs, &n_results);
+    }
+  }
+
+  printf("%s  ]\n}\n", n_results ? "\n" : "");
+  return st;
+}
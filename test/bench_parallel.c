@@ -0,0 +1,131 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+// Benchmark for how parallel reading and writing scale with threads
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench_utils.h"
+#include "int_test_utils.h"
+
+#include <exess/exess.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static char*
+grow_heap(void* const   handle,
+          const size_t  min_size,
+          size_t* const heap_size,
+          char* const   heap)
+{
+  (void)handle;
+
+  const size_t size = (*heap_size * 2U > min_size) ? (*heap_size * 2U)
+                                                   : min_size;
+
+  char* const new_heap = (char*)realloc(heap, size);
+  if (new_heap) {
+    *heap_size = size;
+  }
+
+  return new_heap;
+}
+
+static int
+print_usage(const char* const name)
+{
+  fprintf(stderr, "Usage: %s [OPTION]...\n", name);
+  fprintf(stderr,
+          "  -n NUM_VALUES  Number of values to read and write\n"
+          "  -t MAX_THREAD  Maximum number of threads\n");
+  return 1;
+}
+
+int
+main(int argc, char** argv)
+{
+  size_t   n_values    = 1000000U;
+  unsigned max_threads = 8U;
+
+  for (int a = 1; a < argc; ++a) {
+    if (argv[a][0] != '-' || a + 1 >= argc) {
+      return print_usage(argv[0]);
+    }
+
+    if (argv[a][1] == 'n') {
+      n_values = strtoul(argv[++a], NULL, 10);
+    } else if (argv[a][1] == 't') {
+      max_threads = (unsigned)strtoul(argv[++a], NULL, 10);
+    } else {
+      return print_usage(argv[0]);
+    }
+  }
+
+  double* const values  = (double*)calloc(n_values, sizeof(double));
+  double* const out     = (double*)calloc(n_values, sizeof(double));
+  size_t* const offsets = (size_t*)calloc(n_values + 1U, sizeof(size_t));
+  ExessStringView* const strings =
+    (ExessStringView*)calloc(n_values, sizeof(ExessStringView));
+  if (!values || !out || !offsets || !strings) {
+    return 1;
+  }
+
+  // Generate random finite doubles (with an exponent that isn't all ones)
+  uint64_t rng = 1U;
+  for (size_t i = 0U; i < n_values; ++i) {
+    do {
+      rng = lcg64(rng);
+    } while (((rng >> 52U) & 0x7FFU) == 0x7FFU);
+
+    memcpy(&values[i], &rng, sizeof(double));
+  }
+
+  size_t heap_size = 0U;
+  char*  heap      = NULL;
+
+  printf("threads\twrite_ns\tread_ns\n");
+  for (unsigned t = 1U; t <= max_threads; ++t) {
+    const double t0 = bench_now();
+    exess_parallel_write_values(t,
+                                EXESS_DOUBLE,
+                                n_values,
+                                n_values * sizeof(double),
+                                values,
+                                offsets,
+                                &heap_size,
+                                &heap,
+                                grow_heap,
+                                NULL);
+
+    const double t1 = bench_now();
+    for (size_t i = 0U; i < n_values; ++i) {
+      strings[i].data   = heap + offsets[i];
+      strings[i].length = offsets[i + 1U] - offsets[i];
+    }
+
+    const double t2 = bench_now();
+    exess_parallel_read_values(t,
+                               EXESS_DOUBLE,
+                               n_values,
+                               strings,
+                               n_values * sizeof(double),
+                               out,
+                               NULL);
+
+    const double t3 = bench_now();
+    printf("%u\t%.2f\t%.2f\n",
+           t,
+           (t1 - t0) * 1e9 / (double)n_values,
+           (t3 - t2) * 1e9 / (double)n_values);
+  }
+
+  free(heap);
+  free(strings);
+  free(offsets);
+  free(out);
+  free(values);
+  return 0;
+}
@@ -0,0 +1,18 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#ifndef EXESS_TEST_BENCH_UTILS_H
+#define EXESS_TEST_BENCH_UTILS_H
+
+#include <time.h>
+
+/// Return the current time from a monotonic clock in seconds
+static inline double
+bench_now(void)
+{
+  struct timespec ts = {0, 0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+#endif // EXESS_TEST_BENCH_UTILS_H
@@ -1,4 +1,4 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
@@ -24,6 +24,16 @@ check(const size_t      expected_read_count,
   assert(r.status == expected_status);
   assert(r.read_count == expected_read_count);
   assert(r.write_count == expected_write_count);
+
+  if (expected_status != EXESS_NO_SPACE) {
+    const ExessVariableResult m =
+      exess_measure_base64(strlen(string), string);
+
+    assert(m.status == r.status);
+    assert(m.read_count == r.read_count);
+    assert(m.write_count == r.write_count);
+  }
+
   assert(r.write_count > 0 || buf[0] == 1);
   if (expected_write_count > 0) {
     assert(!strncmp(buf, expected_value, expected_write_count));
@@ -177,6 +187,334 @@ test_round_trip(void)
   }
 }
 
+// Long enough to cover several blocks of any vectorized implementation
+#define N_BYTES 240U
+#define LENGTH 320U
+
+/// Fill `data` with a test pattern and write its encoding to `str` if given
+static void
+make_data(uint8_t data[N_BYTES], char* const str)
+{
+  for (size_t i = 0U; i < N_BYTES; ++i) {
+    data[i] = (uint8_t)((i * 7U) + 3U);
+  }
+
+  if (str) {
+    assert(!exess_write_base64(N_BYTES, data, LENGTH + 2U, str).status);
+    assert(strlen(str) == LENGTH);
+  }
+}
+
+static void
+test_long_strings(void)
+{
+  uint8_t data[N_BYTES]    = {0U};
+  char    str[LENGTH + 2U] = {0};
+  make_data(data, str);
+
+  // Trailing whitespace is skipped
+  char padded[322] = {0};
+  memcpy(padded, str, LENGTH);
+  padded[LENGTH] = '\n';
+
+  uint8_t             decoded[240] = {0U};
+  ExessVariableResult r = exess_read_base64(sizeof(decoded), decoded, padded);
+  assert(!r.status);
+  assert(r.read_count == LENGTH + 1U);
+  assert(r.write_count == N_BYTES);
+  assert(!memcmp(decoded, data, N_BYTES));
+
+  r = exess_measure_base64(LENGTH + 1U, padded);
+  assert(!r.status);
+  assert(r.read_count == LENGTH + 1U);
+  assert(r.write_count == N_BYTES);
+
+  for (size_t i = 0U; i < LENGTH; ++i) {
+    // Invalid characters are reported at the same offset as always
+    char bad[322] = {0};
+    memcpy(bad, str, LENGTH);
+    bad[i] = '!';
+
+    r = exess_read_base64(sizeof(decoded), decoded, bad);
+    assert(r.status == EXESS_EXPECTED_BASE64);
+    assert(r.read_count == i);
+    assert(r.write_count == i / 4U * 3U);
+    assert(!memcmp(decoded, data, r.write_count));
+
+    r = exess_measure_base64(LENGTH, bad);
+    assert(r.status == EXESS_EXPECTED_BASE64);
+    assert(r.read_count == i);
+    assert(r.write_count == i / 4U * 3U);
+
+    // Whitespace is skipped anywhere
+    char spaced[322] = {0};
+    memcpy(spaced, str, i);
+    spaced[i] = '\n';
+    memcpy(spaced + i + 1U, str + i, LENGTH - i);
+
+    memset(decoded, 0, sizeof(decoded));
+    r = exess_read_base64(sizeof(decoded), decoded, spaced);
+    assert(!r.status);
+    assert(r.read_count == LENGTH + 1U);
+    assert(r.write_count == N_BYTES);
+    assert(!memcmp(decoded, data, N_BYTES));
+
+    r = exess_measure_base64(LENGTH + 1U, spaced);
+    assert(!r.status);
+    assert(r.read_count == LENGTH + 1U);
+    assert(r.write_count == N_BYTES);
+
+    // Running out of space is reported at the end of the chunk that didn't fit
+    const size_t out_size = i / 4U * 3U;
+    r = exess_read_base64(out_size, decoded, str);
+    assert(r.status == EXESS_NO_SPACE);
+    assert(r.read_count == (i / 4U * 4U) + 4U);
+    assert(r.write_count == out_size);
+  }
+}
+
+static void
+test_exact_output(void)
+{
+  uint8_t data[N_BYTES]    = {0U};
+  char    str[LENGTH + 2U] = {0};
+  make_data(data, str);
+
+  // Only the decoded bytes are written, even with space for more
+  for (size_t len = 4U; len <= LENGTH; len += 4U) {
+    uint8_t decoded[N_BYTES + 64U];
+    memset(decoded, 0xAB, sizeof(decoded));
+
+    const ExessVariableResult r =
+      exess_read_value_n(EXESS_BASE64, sizeof(decoded), decoded, len, str);
+    assert(!r.status);
+    assert(r.read_count == len);
+    assert(r.write_count == len / 4U * 3U);
+    assert(!memcmp(decoded, data, r.write_count));
+
+    for (size_t i = r.write_count; i < sizeof(decoded); ++i) {
+      assert(decoded[i] == 0xAB);
+    }
+  }
+}
+
+static void
+test_null_terminated(void)
+{
+  // Shorter than the output, so vectorized decoding is limited by the input
+  static const size_t n_bytes = 60U;
+  static const size_t length  = 80U;
+
+  uint8_t data[N_BYTES]     = {0U};
+  char    full[LENGTH + 2U] = {0};
+  make_data(data, full);
+
+  // Reading stops at the terminator of an allocation shorter than the length
+  char* const str = (char*)calloc(length + 1U, 1U);
+  memcpy(str, full, length);
+
+  uint8_t                   decoded[240] = {0U};
+  const ExessVariableResult r            = exess_read_value_n(
+    EXESS_BASE64, sizeof(decoded), decoded, 1000U, str);
+
+  assert(!r.status);
+  assert(r.read_count == length);
+  assert(r.write_count == n_bytes);
+  assert(!memcmp(decoded, data, n_bytes));
+
+  // Measuring stops there too, and can be given no length at all
+  ExessVariableResult m = exess_measure_base64(1000U, str);
+  assert(!m.status);
+  assert(m.read_count == length);
+  assert(m.write_count == n_bytes);
+
+  m = exess_measure_base64(SIZE_MAX, str);
+  assert(!m.status);
+  assert(m.read_count == length);
+  assert(m.write_count == n_bytes);
+
+  free(str);
+}
+
+static void
+test_in_place(void)
+{
+  uint8_t data[N_BYTES]    = {0U};
+  char    str[LENGTH + 2U] = {0};
+  make_data(data, str);
+
+  // Decode a copy with leading and trailing whitespace over itself
+  char buf[324] = {0};
+  buf[0] = ' ';
+  memcpy(buf + 1U, str, LENGTH);
+  buf[LENGTH + 1U] = '\n';
+  buf[LENGTH + 2U] = 'X';
+
+  ExessVariableResult r = exess_read_base64_in_place(LENGTH + 2U, buf);
+  assert(!r.status);
+  assert(r.read_count == LENGTH + 2U);
+  assert(r.write_count == N_BYTES);
+  assert(!memcmp(buf, data, N_BYTES));
+  assert(buf[LENGTH + 2U] == 'X');
+
+  // Errors are reported like when decoding into a separate buffer
+  memcpy(buf, str, LENGTH);
+  buf[LENGTH / 2U] = '!';
+  r = exess_read_base64_in_place(LENGTH, buf);
+  assert(r.status == EXESS_EXPECTED_BASE64);
+  assert(r.read_count == LENGTH / 2U);
+  assert(!memcmp(buf, data, r.write_count));
+
+  // Decoding stops at the terminator of an allocation shorter than the length
+  char* const copy = (char*)calloc(LENGTH + 1U, 1U);
+  memcpy(copy, str, LENGTH);
+  r = exess_read_base64_in_place(1000U, copy);
+  assert(!r.status);
+  assert(r.read_count == LENGTH);
+  assert(r.write_count == N_BYTES);
+  assert(!memcmp(copy, data, N_BYTES));
+  free(copy);
+}
+
+static void
+test_decoder(void)
+{
+  uint8_t data[N_BYTES]    = {0U};
+  char    str[LENGTH + 2U] = {0};
+  make_data(data, str);
+
+  // Break the string into lines like a wrapped file might
+  char   wrapped[400] = {0};
+  size_t wrapped_len  = 0U;
+  for (size_t i = 0U; i < LENGTH; ++i) {
+    if (i && !(i % 19U)) {
+      wrapped[wrapped_len++] = '\n';
+    }
+    wrapped[wrapped_len++] = str[i];
+  }
+
+  // Any split into two chunks decodes the same
+  uint8_t            decoded[240] = {0U};
+  ExessBase64Decoder decoder;
+  for (size_t split = 0U; split <= wrapped_len; ++split) {
+    memset(decoded, 0, sizeof(decoded));
+    exess_base64_decoder_init(&decoder);
+
+    ExessVariableResult r = exess_base64_decoder_feed(
+      &decoder, split, wrapped, sizeof(decoded), decoded);
+    assert(!r.status);
+    assert(r.read_count == split);
+
+    const size_t o = r.write_count;
+    r              = exess_base64_decoder_feed(&decoder,
+                                  wrapped_len - split,
+                                  wrapped + split,
+                                  sizeof(decoded) - o,
+                                  decoded + o);
+    assert(!r.status);
+    assert(r.read_count == wrapped_len - split);
+    assert(o + r.write_count == N_BYTES);
+    assert(!exess_base64_decoder_finish(&decoder));
+    assert(!memcmp(decoded, data, N_BYTES));
+  }
+
+  // Decoding one character at a time into a tiny buffer can be resumed
+  memset(decoded, 0, sizeof(decoded));
+  exess_base64_decoder_init(&decoder);
+  size_t o = 0U;
+  for (size_t i = 0U; i < wrapped_len; ++i) {
+    ExessVariableResult r = exess_base64_decoder_feed(
+      &decoder, 1U, wrapped + i, 1U, decoded + o);
+    if (r.status == EXESS_NO_SPACE) {
+      assert(!r.read_count);
+      r = exess_base64_decoder_feed(
+        &decoder, 1U, wrapped + i, sizeof(decoded) - o, decoded + o);
+    }
+
+    assert(!r.status);
+    assert(r.read_count == 1U);
+    o += r.write_count;
+  }
+
+  assert(o == N_BYTES);
+  assert(!exess_base64_decoder_finish(&decoder));
+  assert(!memcmp(decoded, data, N_BYTES));
+
+  // Incomplete input
+  exess_base64_decoder_init(&decoder);
+  ExessVariableResult r =
+    exess_base64_decoder_feed(&decoder, 3U, "Zm9", sizeof(decoded), decoded);
+  assert(!r.status);
+  assert(r.read_count == 3U);
+  assert(!r.write_count);
+  assert(exess_base64_decoder_finish(&decoder) == EXESS_EXPECTED_BASE64);
+
+  // Invalid characters
+  r = exess_base64_decoder_feed(&decoder, 2U, "v!", sizeof(decoded), decoded);
+  assert(r.status == EXESS_EXPECTED_BASE64);
+  assert(r.read_count == 1U);
+  assert(r.write_count == 3U);
+
+  // Invalid padding
+  exess_base64_decoder_init(&decoder);
+  r = exess_base64_decoder_feed(&decoder, 4U, "Z=9v", sizeof(decoded), decoded);
+  assert(r.status == EXESS_BAD_VALUE);
+  assert(r.read_count == 4U);
+  assert(!r.write_count);
+}
+
+static void
+test_encoder(void)
+{
+  uint8_t data[N_BYTES] = {0U};
+  make_data(data, NULL);
+
+  for (size_t size = 0U; size <= N_BYTES; size += 7U) {
+    char expected[322] = {0};
+    assert(!exess_write_base64(size, data, sizeof(expected), expected).status);
+
+    // Feed the data in chunks of various sizes into a small output buffer
+    for (size_t chunk_size = 1U; chunk_size < 50U; chunk_size += 6U) {
+      char               str[322] = {0};
+      size_t             o        = 0U;
+      ExessBase64Encoder encoder;
+      exess_base64_encoder_init(&encoder);
+      for (size_t i = 0U; i < size;) {
+        const size_t n_in  = (size - i < chunk_size) ? size - i : chunk_size;
+        const size_t n_out = 4U + (chunk_size % 11U);
+
+        const ExessVariableResult r =
+          exess_base64_encoder_feed(&encoder, n_in, data + i, n_out, str + o);
+
+        assert(!r.status || r.status == EXESS_NO_SPACE);
+        assert(r.read_count || r.write_count);
+        i += r.read_count;
+        o += r.write_count;
+      }
+
+      const ExessResult r = exess_base64_encoder_finish(&encoder, 4U, str + o);
+      assert(!r.status);
+      o += r.count;
+      assert(o == strlen(expected));
+      assert(!strcmp(str, expected));
+    }
+  }
+
+  // Finishing needs space for a whole group
+  ExessBase64Encoder encoder;
+  exess_base64_encoder_init(&encoder);
+  char                buf[4] = {0};
+  ExessVariableResult r =
+    exess_base64_encoder_feed(&encoder, 1U, data, sizeof(buf), buf);
+  assert(!r.status);
+  assert(r.read_count == 1U);
+  assert(!r.write_count);
+  assert(exess_base64_encoder_finish(&encoder, 3U, buf).status ==
+         EXESS_NO_SPACE);
+  assert(exess_base64_encoder_finish(&encoder, 4U, buf).count == 4U);
+  assert(!exess_base64_encoder_finish(&encoder, 4U, buf).count);
+}
+
 int
 main(void)
 {
@@ -186,6 +524,12 @@ main(void)
   test_read_overflow();
   test_write_overflow();
   test_round_trip();
+  test_long_strings();
+  test_exact_output();
+  test_null_terminated();
+  test_in_place();
+  test_decoder();
+  test_encoder();
 
   return 0;
 }
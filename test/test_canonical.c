@@ -1,4 +1,4 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
@@ -441,6 +441,61 @@ test_binary(void)
   check(EXESS_BASE64, 0, "", EXESS_EXPECTED_BASE64, 0, "");
 }
 
+static void
+test_long_values(void)
+{
+  // Long enough to cover several blocks of any vectorized scanning
+  char in[512]  = {0};
+  char out[328] = {0};
+
+  // Decimal with leading whitespace and zeros, and trailing zeros
+  memset(in, ' ', 40U);
+  memset(in + 40U, '0', 20U);
+  for (size_t i = 0U; i < 200U; ++i) {
+    in[60U + i]  = (char)('1' + (i % 9U));
+    out[i]       = in[60U + i];
+    in[261U + i] = (i < 100U) ? (char)('1' + (i % 7U)) : '0';
+  }
+  memcpy(out + 201U, in + 261U, 100U);
+  in[260U]  = '.';
+  out[200U] = '.';
+  out[301U] = '\0';
+  check(EXESS_DECIMAL, 461U, in, EXESS_SUCCESS, 301U, out);
+
+  // Integer, which stops at the decimal point
+  out[200U] = '\0';
+  check(EXESS_INTEGER, 240U, in + 20U, EXESS_SUCCESS, 200U, out);
+
+  // Hex with leading whitespace, stopping at an invalid character
+  memset(in, 0, sizeof(in));
+  memset(out, 0, sizeof(out));
+  memset(in, '\t', 50U);
+  for (size_t i = 0U; i < 300U; ++i) {
+    in[50U + i] = "0123456789ABCDEF"[(i * 7U) % 16U];
+    out[i]      = in[50U + i];
+  }
+  check(EXESS_HEX, 350U, in, EXESS_SUCCESS, 300U, out);
+  in[50U + 299U] = 'x';
+  check(EXESS_HEX, 349U, in, EXESS_EXPECTED_HEX, 0U, NULL);
+
+  // Base64 with runs of whitespace between runs of digits
+  memset(in, 0, sizeof(in));
+  memset(out, 0, sizeof(out));
+  size_t n_in  = 0U;
+  size_t n_out = 0U;
+  for (size_t i = 0U; i < 6U; ++i) {
+    for (size_t j = 0U; j < 40U; ++j) {
+      in[n_in++]   = (char)('A' + ((i + j) % 26U));
+      out[n_out++] = in[n_in - 1U];
+    }
+
+    for (size_t j = 0U; j < 20U + i; ++j) {
+      in[n_in++] = (j % 2U) ? ' ' : '\n';
+    }
+  }
+  check(EXESS_BASE64, n_in, in, EXESS_SUCCESS, n_out, out);
+}
+
 int
 main(void)
 {
@@ -452,6 +507,7 @@ main(void)
   test_time();
   test_date_time();
   test_binary();
+  test_long_values();
 
   return 0;
 }
@@ -1,12 +1,18 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
 
+#include "int_test_utils.h"
+
 #include <exess/exess.h>
 
 #include <assert.h>
+#include <math.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 typedef bool (*ComparisonPredicate)(int);
 
@@ -180,13 +186,13 @@ test_compare(void)
   check_comparison(EXESS_DURATION, "P31D", "P1M", maybe_less);
   check_comparison(EXESS_DURATION, "P32D", "P1M", greater);
   check_comparison(EXESS_DURATION, "P1M", "P28D", maybe_greater);
-  check_comparison(EXESS_DURATION, "P330D", "P6M", maybe_less);
-  check_comparison(EXESS_DURATION, "P4M", "P4M28D", maybe_less);
-  check_comparison(EXESS_DURATION, "P4M", "P4M31D", maybe_less);
-  check_comparison(EXESS_DURATION, "P4M", "P4M32D", maybe_less);
+  check_comparison(EXESS_DURATION, "P330D", "P6M", greater);
+  check_comparison(EXESS_DURATION, "P4M", "P4M28D", less);
+  check_comparison(EXESS_DURATION, "P4M", "P4M31D", less);
+  check_comparison(EXESS_DURATION, "P4M", "P4M32D", less);
   check_comparison(EXESS_DURATION, "P3M29D", "P4M", less);
   check_comparison(EXESS_DURATION, "P3M31D", "P4M", maybe_less);
-  check_comparison(EXESS_DURATION, "P4M27D", "P4M", maybe_greater);
+  check_comparison(EXESS_DURATION, "P4M27D", "P4M", greater);
 
   // Months and seconds
   check_comparison(EXESS_DURATION, "P1MT0.000000001S", "P1M", greater);
@@ -215,6 +221,12 @@ test_compare(void)
   check_comparison(EXESS_DURATION, "PT31622400S", "P1Y", maybe_less);
   check_comparison(EXESS_DURATION, "PT31622401S", "P1Y", greater);
 
+  // Mixed fields that are ordered from every reference dateTime
+  check_comparison(EXESS_DURATION, "P5M", "P1M121DT22H56M58S", greater);
+  check_comparison(EXESS_DURATION, "P2Y8M105D", "P2Y11M13DT11H19M44S", less);
+  check_comparison(EXESS_DURATION, "P1Y1M365D", "P2Y1M", equal);
+  check_comparison(EXESS_DURATION, "-P2Y1M365D", "-P3Y1M", equal);
+
   // DateTime
 
   // Equality
@@ -297,6 +309,12 @@ test_compare(void)
                     "2001-02-04T02:13:15Z",
                     "2001-02-04T16:13:16");
 
+  // UTC comparable, in different years before normalization
+  check_comparison(EXESS_DATE_TIME,
+                   "2001-12-31T23:00:00-05:00",
+                   "2002-01-01T00:00:00Z",
+                   greater);
+
   // Local and UTC incomparable, "same" time
   check_comparison(EXESS_DATE_TIME,
                    "2001-02-03T12:13:14Z",
@@ -426,10 +444,219 @@ test_compare(void)
   check_comparison(EXESS_BASE64, "Zm9v", "Zm9v", equal);
 }
 
+static int
+compare_keys(const ExessDatatype datatype,
+             const size_t        lhs_size,
+             const void* const   lhs,
+             const size_t        rhs_size,
+             const void* const   rhs)
+{
+  uint8_t lhs_key[EXESS_MAX_FIXED_SIZE + EXESS_MAX_SORT_KEY_SIZE] = {0U};
+  uint8_t rhs_key[EXESS_MAX_FIXED_SIZE + EXESS_MAX_SORT_KEY_SIZE] = {0U};
+
+  const ExessResult l =
+    exess_write_sort_key(datatype, lhs_size, lhs, sizeof(lhs_key), lhs_key);
+  const ExessResult r =
+    exess_write_sort_key(datatype, rhs_size, rhs, sizeof(rhs_key), rhs_key);
+
+  assert(!l.status);
+  assert(!r.status);
+  assert(exess_write_sort_key(datatype, lhs_size, lhs, 0U, NULL).count ==
+         l.count);
+
+  const size_t min_count = l.count < r.count ? l.count : r.count;
+  const int    cmp       = memcmp(lhs_key, rhs_key, min_count);
+
+  return cmp                   ? cmp
+         : (l.count < r.count) ? -1
+         : (l.count > r.count) ? 1
+                               : 0;
+}
+
+static void
+check_sort_key(const ExessDatatype datatype,
+               const char* const   lhs_string,
+               const char* const   rhs_string)
+{
+  ExessValue lhs = {false};
+  ExessValue rhs = {false};
+
+  const ExessVariableResult l =
+    exess_read_value(datatype, sizeof(lhs), &lhs, lhs_string);
+  const ExessVariableResult r =
+    exess_read_value(datatype, sizeof(rhs), &rhs, rhs_string);
+
+  assert(!l.status);
+  assert(!r.status);
+
+  const ExessOrder order = exess_compare_value(
+    datatype, l.write_count, &lhs, datatype, r.write_count, &rhs);
+
+  const int cmp =
+    compare_keys(datatype, l.write_count, &lhs, r.write_count, &rhs);
+
+  assert((cmp < 0) == (order < 0));
+  assert((cmp == 0) == (order == 0));
+  assert((cmp > 0) == (order > 0));
+}
+
+static void
+check_sort_keys(const ExessDatatype datatype,
+                const char* const   low,
+                const char* const   mid,
+                const char* const   high)
+{
+  check_sort_key(datatype, low, mid);
+  check_sort_key(datatype, mid, mid);
+  check_sort_key(datatype, high, mid);
+  check_sort_key(datatype, mid, low);
+  check_sort_key(datatype, mid, high);
+}
+
+/// Return a random number less than `n` (using the better high bits)
+static uint32_t
+random_below(uint32_t* const rng, const uint32_t n)
+{
+  *rng = lcg32(*rng);
+  return (*rng >> 8U) % n;
+}
+
+static ExessDuration
+random_duration(uint32_t* const rng)
+{
+  // Mostly days and whole seconds, so many pairs are comparable or equal
+  const uint32_t months  = random_below(rng, 40U);
+  const uint32_t days    = random_below(rng, 1300U);
+  const uint32_t seconds =
+    random_below(rng, 4U) ? 0U : random_below(rng, 86400U);
+  const uint32_t nanos = random_below(rng, 8U) ? 0U : random_below(rng, 1000U);
+  const int32_t  sign  = random_below(rng, 2U) ? -1 : 1;
+
+  const ExessDuration d = {
+    sign * (int32_t)months,
+    sign * (int32_t)((days * 86400U) + seconds),
+    sign * (int32_t)nanos,
+  };
+
+  return d;
+}
+
+static void
+test_duration_sort_keys(void)
+{
+  // Keys agree with every definite comparison of random durations
+  uint32_t rng = 1U;
+  for (unsigned i = 0U; i < 200000U; ++i) {
+    const ExessDuration lhs  = random_duration(&rng);
+    ExessDuration       rhs  = random_duration(&rng);
+    const int32_t       sign = (lhs.months < 0 || lhs.seconds < 0) ? -1 : 1;
+    if (sign * lhs.seconds >= 366 * 86400 && !random_below(&rng, 4U)) {
+      // Trade days for a year, which is sometimes equal from every reference
+      const int32_t days = random_below(&rng, 2U) ? 365 : 366;
+
+      rhs.months      = lhs.months + (sign * 12);
+      rhs.seconds     = lhs.seconds - (sign * days * 86400);
+      rhs.nanoseconds = lhs.nanoseconds;
+    }
+
+    const ExessOrder order = exess_compare_duration(lhs, rhs);
+    const int        cmp   = compare_keys(
+      EXESS_DURATION, sizeof(lhs), &lhs, sizeof(rhs), &rhs);
+
+    assert(order != EXESS_ORDER_STRICTLY_LESS || cmp < 0);
+    assert(order != EXESS_ORDER_EQUAL || cmp == 0);
+    assert(order != EXESS_ORDER_STRICTLY_GREATER || cmp > 0);
+  }
+}
+
+static void
+test_sort_key(void)
+{
+  // Errors
+  const int32_t value   = 42;
+  uint8_t       key[16] = {0U};
+
+  assert(exess_write_sort_key(EXESS_NOTHING, 4U, &value, 16U, key).status ==
+         EXESS_UNSUPPORTED);
+  assert(exess_write_sort_key(EXESS_INT, 2U, &value, 16U, key).status ==
+         EXESS_BAD_VALUE);
+  assert(exess_write_sort_key(EXESS_INT, 4U, &value, 3U, key).status ==
+         EXESS_NO_SPACE);
+
+  // Numbers
+  check_sort_keys(EXESS_BOOLEAN, "false", "true", "true");
+  check_sort_keys(EXESS_DECIMAL, "-1.5", "0.0", "1.5");
+  check_sort_keys(EXESS_DOUBLE, "-INF", "-1E300", "-4.9E-324");
+  check_sort_keys(EXESS_DOUBLE, "-1.0", "0.0", "4.9E-324");
+  check_sort_keys(EXESS_DOUBLE, "1.0", "1.5", "INF");
+  check_sort_keys(EXESS_FLOAT, "-INF", "-1.5", "-1.4E-45");
+  check_sort_keys(EXESS_FLOAT, "-1.0", "0.0", "1.0");
+  check_sort_keys(EXESS_FLOAT, "1.0", "3.4E38", "INF");
+  check_sort_keys(EXESS_INTEGER, "-9223372036854775808", "0", "1");
+  check_sort_keys(EXESS_LONG, "-1", "0", "9223372036854775807");
+  check_sort_keys(EXESS_INT, "-2147483648", "-1", "2147483647");
+  check_sort_keys(EXESS_SHORT, "-32768", "255", "256");
+  check_sort_keys(EXESS_BYTE, "-128", "-1", "127");
+  check_sort_keys(EXESS_ULONG, "0", "255", "18446744073709551615");
+  check_sort_keys(EXESS_UINT, "0", "256", "4294967295");
+  check_sort_keys(EXESS_USHORT, "1", "255", "65535");
+  check_sort_keys(EXESS_UBYTE, "0", "1", "255");
+
+  // Negative zero is equal to zero
+  check_sort_key(EXESS_DOUBLE, "-0.0", "0.0");
+  check_sort_key(EXESS_FLOAT, "-0.0", "0.0");
+
+  // NaN sorts after everything, including infinity
+  const double dnan = (double)NAN;
+  const double dinf = (double)INFINITY;
+  assert(compare_keys(EXESS_DOUBLE, 8U, &dnan, 8U, &dinf) > 0);
+  assert(compare_keys(EXESS_DOUBLE, 8U, &dnan, 8U, &dnan) == 0);
+
+  const float fnan = NAN;
+  const float finf = INFINITY;
+  assert(compare_keys(EXESS_FLOAT, 4U, &fnan, 4U, &finf) > 0);
+
+  // Durations
+  check_sort_keys(EXESS_DURATION, "-P1Y", "PT0S", "P1M");
+  check_sort_keys(EXESS_DURATION, "PT1S", "PT1.5S", "PT2S");
+  check_sort_keys(EXESS_DURATION, "P1D", "P1M", "P1Y");
+  check_sort_keys(EXESS_DURATION, "-PT1.5S", "-PT1S", "-PT0.5S");
+  check_sort_key(EXESS_DURATION, "P5M", "P1M121DT22H56M58S");
+  check_sort_key(EXESS_DURATION, "P2Y8M105D", "P2Y11M13DT11H19M44S");
+  check_sort_key(EXESS_DURATION, "P1Y1M365D", "P2Y1M");
+  check_sort_key(EXESS_DURATION, "-P2Y1M365D", "-P3Y1M");
+
+  // Dates and times
+  check_sort_keys(EXESS_DATE, "-32768-01-01", "2001-02-03", "32767-12-31");
+  check_sort_keys(EXESS_DATE, "2001-02-03Z", "2001-02-04Z", "2001-02-05Z");
+  check_sort_keys(EXESS_DATE, "2001-02-03", "2001-02-05Z", "2001-02-07");
+  check_sort_keys(EXESS_TIME, "12:00:00Z", "12:00:00-01:00", "23:59:59Z");
+  check_sort_keys(EXESS_TIME, "12:00:00", "12:00:00.5", "12:00:01");
+  check_sort_keys(EXESS_DATE_TIME,
+                  "2001-12-31T23:00:00-00:30",
+                  "2001-12-31T23:00:00-05:00",
+                  "2002-01-01T12:00:00Z");
+  check_sort_keys(EXESS_DATE_TIME,
+                  "2001-02-03T04:05:06",
+                  "2001-02-04T04:05:06Z",
+                  "2001-02-05T04:05:06");
+
+  // Local times sort before UTC times at the same instant
+  check_sort_key(
+    EXESS_DATE_TIME, "2001-02-03T04:05:06", "2001-02-03T04:05:06Z");
+
+  // Binary
+  check_sort_keys(EXESS_HEX, "0102", "010204", "0103");
+  check_sort_keys(EXESS_HEX, "01", "0101", "010101");
+  check_sort_keys(EXESS_BASE64, "Zg==", "Zm8=", "Zm9v");
+}
+
 int
 main(void)
 {
   test_compare();
+  test_sort_key();
+  test_duration_sort_keys();
 
   return 0;
 }
@@ -1,4 +1,4 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
@@ -24,6 +24,9 @@ static const ExessDateTime utc_max =
   {INT16_MAX, 12, 31, EXESS_UTC, 24, 0, 0, 0};
 
 static const ExessDateTime nano      = {2001, 1, 1, 56, 0, 0, 0, 1};
+static const ExessDateTime year0     = {0, 1, 1, EXESS_LOCAL, 0, 0, 0, 0};
+static const ExessDateTime year9999  = {9999, 12, 31, -1, 23, 59, 59, 5000};
+static const ExessDateTime year10000 = {10000, 1, 1, EXESS_UTC, 0, 0, 0, 0};
 static const ExessDateTime garbage1  = {2004, 0, 1, 56, 12, 0, 0, 0};
 static const ExessDateTime garbage2  = {2005, 13, 1, 56, 12, 0, 0, 0};
 static const ExessDateTime garbage3  = {2006, 1, 0, 56, 12, 0, 0, 0};
@@ -117,6 +120,16 @@ test_add(void)
   check_add("2001-02-01T00:00:00", "-P1D", "2001-01-31T00:00:00");
   check_add("2001-01-01T00:00:00", "-P1M", "2000-12-01T00:00:00");
 
+  // Carrying days past the end of the month after adding months
+  check_add("2000-01-31T00:00:00", "P1M", "2000-03-02T00:00:00");
+  check_add("2001-03-31T00:00:00", "-P1M", "2001-03-03T00:00:00");
+
+  // Carrying many days across years
+  check_add("1970-01-01T00:00:00", "PT2147483646S", "2038-01-19T03:14:06");
+  check_add("2001-01-01T00:00:00", "PT2147483646S", "2069-01-19T03:14:06");
+  check_add("2001-01-01T00:00:00", "-PT2147483646S", "1932-12-13T20:45:54");
+  check_add("0001-01-01T00:00:00", "P24000D", "0066-09-17T00:00:00");
+
   // Underflow and overflow
 
   static const ExessDuration minus_month      = {-1, 0, 0};
@@ -235,6 +248,80 @@ test_to_utc(void)
   check_to_utc("2001-01-01T00:14:59+00:15", "2000-12-31T23:59:59Z");
 }
 
+static void
+check_epoch(const char* const datetime_string,
+            const int64_t     expected_seconds,
+            const uint32_t    expected_nanoseconds)
+{
+  ExessDateTime datetime = {0, 0U, 0U, EXESS_LOCAL, 0U, 0U, 0U, 0U};
+
+  ExessResult r = exess_read_date_time(&datetime, datetime_string);
+  assert(!r.status);
+
+  // Check conversion to epoch time
+  const ExessEpochTime time = exess_date_time_to_epoch(datetime);
+  assert(time.seconds == expected_seconds);
+  assert(time.nanoseconds == expected_nanoseconds);
+
+  // Check that converting back in the same timezone is lossless
+  char buf[EXESS_MAX_DATE_TIME_LENGTH + 1] = {42};
+  init_out_buf(sizeof(buf), buf);
+
+  const ExessDateTime back = exess_date_time_from_epoch(time, datetime.zone);
+  r = exess_write_date_time(back, sizeof(buf), buf);
+  assert(!r.status);
+  assert(datetime.hour == 24U || !strcmp(buf, datetime_string));
+
+  // Check that converting back to UTC is the same as exess_date_time_to_utc()
+  if (datetime.zone != EXESS_LOCAL) {
+    const ExessDateTime utc_back = exess_date_time_from_epoch(time, EXESS_UTC);
+    const ExessDateTime expected = exess_date_time_to_utc(datetime);
+    assert(!memcmp(&utc_back, &expected, sizeof(ExessDateTime)));
+  }
+}
+
+static void
+test_epoch(void)
+{
+  // The epoch itself and times around it
+  check_epoch("1970-01-01T00:00:00Z", 0, 0U);
+  check_epoch("1970-01-01T00:00:00.5Z", 0, 500000000U);
+  check_epoch("1969-12-31T23:59:59Z", -1, 0U);
+  check_epoch("1969-12-31T23:59:59.999999999Z", -1, 999999999U);
+  check_epoch("1970-01-01T24:00:00Z", 86400, 0U);
+
+  // Zoned and local times
+  check_epoch("2001-02-03T04:05:06Z", 981173106, 0U);
+  check_epoch("2001-02-03T04:05:06-05:30", 981192906, 0U);
+  check_epoch("2001-02-03T09:35:06+05:30", 981173106, 0U);
+  check_epoch("2001-02-03T04:05:06", 981173106, 0U);
+
+  // Distant years
+  check_epoch("0001-01-01T00:00:00Z", INT64_C(-62135596800), 0U);
+  check_epoch("-32768-01-01T00:00:00Z", INT64_C(-1096225401600), 0U);
+  check_epoch("32767-12-31T23:59:59Z", INT64_C(971890963199), 0U);
+
+  // Nanoseconds are carried into seconds
+  const ExessEpochTime carried = {-1, 1500000000U};
+  const ExessDateTime  dt      = exess_date_time_from_epoch(carried, 4);
+  assert(dt.year == 1970 && dt.month == 1U && dt.day == 1U);
+  assert(dt.zone == 4);
+  assert(dt.hour == 1U && dt.minute == 0U && dt.second == 0U);
+  assert(dt.nanosecond == 500000000U);
+
+  // Out of range times saturate
+  const ExessEpochTime past = {INT64_C(-1096225401601), 0U};
+  check_is_underflow(exess_date_time_from_epoch(past, EXESS_UTC), EXESS_UTC);
+  const ExessEpochTime future = {INT64_C(971890963200), 0U};
+  check_is_overflow(exess_date_time_from_epoch(future, 4), 4);
+
+  const ExessEpochTime min = {INT64_MIN, 0U};
+  check_is_underflow(exess_date_time_from_epoch(min, EXESS_LOCAL),
+                     EXESS_LOCAL);
+  const ExessEpochTime max = {INT64_MAX, 999999999U};
+  check_is_overflow(exess_date_time_from_epoch(max, EXESS_LOCAL), EXESS_LOCAL);
+}
+
 static void
 check_read(const char* const   string,
            const ExessStatus   expected_status,
@@ -392,6 +479,82 @@ test_read_date_time(void)
              0);
 }
 
+static void
+test_read_fixed_layout(void)
+{
+  // Fixed layouts that are read quickly
+  check_read(
+    " 2001-02-03T04:05:06Z", EXESS_SUCCESS, 21, 2001, 2, 3, 4, 5, 6, 0, 0);
+  check_read("0000-12-31T23:59:59.5-08:30",
+             EXESS_SUCCESS,
+             27,
+             0,
+             12,
+             31,
+             23,
+             59,
+             59,
+             500000000,
+             -34);
+
+  // Values that don't fit the fixed layout or range are read like usual
+  check_read("12001-02-03T04:05:06",
+             EXESS_SUCCESS,
+             20,
+             12001,
+             2,
+             3,
+             4,
+             5,
+             6,
+             0,
+             EXESS_LOCAL);
+
+  check_read("2001-02-29T04:05:06",
+             EXESS_OUT_OF_RANGE,
+             10,
+             2001,
+             2,
+             29,
+             0,
+             0,
+             0,
+             0,
+             0);
+
+  check_read("2001-02-03T04:60:06",
+             EXESS_OUT_OF_RANGE,
+             16,
+             2001,
+             2,
+             3,
+             4,
+             60,
+             0,
+             0,
+             EXESS_LOCAL);
+
+  check_read("2001-02-03T04:05:0x",
+             EXESS_EXPECTED_DIGIT,
+             18,
+             2001,
+             2,
+             3,
+             4,
+             5,
+             0,
+             0,
+             EXESS_LOCAL);
+
+  // The end of the input is respected even if the layout continues
+  ExessDateTime             value = {0, 0, 0, EXESS_LOCAL, 0, 0, 0, 0};
+  const ExessVariableResult r     = exess_read_value_n(
+    EXESS_DATE_TIME, sizeof(value), &value, 18U, "2001-02-03T04:05:06");
+
+  assert(r.status == EXESS_EXPECTED_DIGIT);
+  assert(r.read_count == 18U);
+}
+
 static void
 check_write(const ExessDateTime value,
             const ExessStatus   expected_status,
@@ -420,6 +583,9 @@ test_write_date_time(void)
   check_write(
     longest, EXESS_SUCCESS, 38, "-32768-12-31T23:59:59.999999999+14:00");
   check_write(nano, EXESS_SUCCESS, 36, "2001-01-01T00:00:00.000000001+14:00");
+  check_write(year0, EXESS_SUCCESS, 20, "0000-01-01T00:00:00");
+  check_write(year9999, EXESS_SUCCESS, 33, "9999-12-31T23:59:59.000005-00:15");
+  check_write(year10000, EXESS_SUCCESS, 22, "10000-01-01T00:00:00Z");
 
   check_write(garbage1, EXESS_BAD_VALUE, 38, "");
   check_write(garbage2, EXESS_BAD_VALUE, 38, "");
@@ -437,6 +603,10 @@ test_write_date_time(void)
   check_write(lowest, EXESS_NO_SPACE, 17, "");
   check_write(lowest, EXESS_NO_SPACE, 18, "");
   check_write(lowest, EXESS_NO_SPACE, 21, "");
+  check_write(year0, EXESS_NO_SPACE, 19, "");
+  check_write(utc, EXESS_NO_SPACE, 20, "");
+  check_write(nano, EXESS_NO_SPACE, 30, "");
+  check_write(year9999, EXESS_NO_SPACE, 32, "");
 
   // Check that nothing is written when there isn't enough space
   char              c = 42;
@@ -452,7 +622,9 @@ main(void)
   test_add();
   test_calendar();
   test_to_utc();
+  test_epoch();
   test_read_date_time();
+  test_read_fixed_layout();
   test_write_date_time();
 
   return 0;
@@ -0,0 +1,220 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "../src/digits.h"
+#include "../src/floating_decimal.h"
+#include "../src/shortest.h"
+#include "../src/warnings.h"
+
+#include "int_test_utils.h"
+#include "num_test_utils.h"
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/// Return the double with representation `rep`
+static double
+double_from_rep(const uint64_t rep)
+{
+  double d = 0.0;
+  memcpy(&d, &rep, sizeof(d));
+  return d;
+}
+
+/// Return the float with representation `rep`
+static float
+float_from_rep(const uint32_t rep)
+{
+  float f = 0.0f;
+  memcpy(&f, &rep, sizeof(f));
+  return f;
+}
+
+/// Check that the fast digit generator matches the reference one exactly
+static void
+check_shortest_digits(const double d)
+{
+  EXESS_DISABLE_CONVERSION_WARNINGS
+  if (!isfinite(d) || d <= 0.0) {
+    return;
+  }
+  EXESS_RESTORE_WARNINGS
+
+  char expected[DBL_DECIMAL_DIG + 2] = {0};
+  char actual[DBL_DECIMAL_DIG + 2]   = {0};
+
+  const ExessDigitCount e = generate_digits(d, DBL_DECIMAL_DIG, expected);
+  const ExessDigitCount a = generate_shortest_digits(d, actual);
+
+  if (a.count != e.count || a.expt != e.expt || strcmp(actual, expected)) {
+    fprintf(stderr,
+            "error: %.17g: expected %sE%d, got %sE%d\n",
+            d,
+            expected,
+            e.expt,
+            actual,
+            a.expt);
+  }
+
+  assert(a.count == e.count);
+  assert(a.expt == e.expt);
+  assert(!strcmp(actual, expected));
+}
+
+static void
+test_shortest_digits(const ExessNumTestOptions opts)
+{
+  // Limits
+  check_shortest_digits(DBL_MIN);
+  check_shortest_digits(DBL_MAX);
+  check_shortest_digits(DBL_EPSILON);
+  check_shortest_digits(double_from_rep(1U));
+  check_shortest_digits(nextafter(DBL_MIN, 0.0));
+  check_shortest_digits(nextafter(DBL_MIN, 1.0));
+  check_shortest_digits(nextafter(DBL_MAX, 0.0));
+
+  // Simple numbers
+  check_shortest_digits(1.0);
+  check_shortest_digits(0.1);
+  check_shortest_digits(0.3);
+  check_shortest_digits(1e23);
+  check_shortest_digits(9007199254740991.0);
+  check_shortest_digits(9007199254740992.0);
+  check_shortest_digits(9007199254740993.0);
+  check_shortest_digits(123456789012345678.0);
+
+  // Integers, powers of ten, and their neighbours
+  for (int i = 0; i < 1024; ++i) {
+    check_shortest_digits((double)i);
+    check_shortest_digits(nextafter((double)i, 0.0));
+    check_shortest_digits(nextafter((double)i, DBL_MAX));
+  }
+
+  for (int i = -325; i <= 308; ++i) {
+    const double p = pow(10.0, i);
+    check_shortest_digits(p);
+    check_shortest_digits(nextafter(p, 0.0));
+    check_shortest_digits(nextafter(p, DBL_MAX));
+  }
+
+  // Powers of two (where the lower boundary is closer)
+  for (int i = -1074; i <= 1023; ++i) {
+    const double p = ldexp(1.0, i);
+    check_shortest_digits(p);
+    check_shortest_digits(nextafter(p, 0.0));
+    check_shortest_digits(nextafter(p, DBL_MAX));
+  }
+
+  // Every exponent with a few significands that have trailing zero bits
+  for (uint64_t e = 0U; e < 0x7FFU; ++e) {
+    for (uint64_t m = 1U; m < 64U; ++m) {
+      check_shortest_digits(double_from_rep((e << 52U) | (m << 46U)));
+      check_shortest_digits(double_from_rep((e << 52U) | m));
+    }
+  }
+
+  fprintf(stderr, "Testing digits randomly with seed %u\n", opts.seed);
+
+  uint64_t rep = opts.seed;
+  for (uint64_t i = 0; i < opts.n_tests; ++i) {
+    rep = lcg64(rep);
+
+    check_shortest_digits(double_from_rep(rep & ~(1ULL << 63U)));
+
+    print_num_test_progress(i, opts.n_tests);
+  }
+}
+
+/// Check that the float digit generator matches the reference one exactly
+static void
+check_float_digits(const float f)
+{
+  EXESS_DISABLE_CONVERSION_WARNINGS
+  if (!isfinite(f) || f <= 0.0f) {
+    return; // Only positive numbers have digits, the sign is written separately
+  }
+  EXESS_RESTORE_WARNINGS
+
+  char expected[FLT_DECIMAL_DIG + 2] = {0};
+  char actual[FLT_DECIMAL_DIG + 2]   = {0};
+
+  const ExessDigitCount e =
+    generate_digits((double)f, FLT_DECIMAL_DIG, expected);
+  const ExessDigitCount a = generate_float_digits(f, actual);
+
+  if (a.count != e.count || a.expt != e.expt || strcmp(actual, expected)) {
+    fprintf(stderr,
+            "error: %.9g: expected %sE%d, got %sE%d\n",
+            (double)f,
+            expected,
+            e.expt,
+            actual,
+            a.expt);
+  }
+
+  assert(a.count == e.count);
+  assert(a.expt == e.expt);
+  assert(!strcmp(actual, expected));
+}
+
+static void
+test_float_digits(const ExessNumTestOptions opts)
+{
+  // Limits
+  check_float_digits(FLT_MIN);
+  check_float_digits(FLT_MAX);
+  check_float_digits(FLT_EPSILON);
+  check_float_digits(float_from_rep(1U));
+  check_float_digits(float_from_rep(0x007FFFFFU));
+
+  // Simple numbers
+  check_float_digits(0.1f);
+  check_float_digits(0.3f);
+  check_float_digits(1.0f);
+  check_float_digits(16777215.0f);
+  check_float_digits(16777216.0f);
+
+  // Powers of two (where the lower boundary is closer)
+  for (int i = -149; i <= 127; ++i) {
+    check_float_digits(ldexpf(1.0f, i));
+  }
+
+  if (opts.exhaustive) {
+    fprintf(stderr, "Testing float digits exhaustively\n");
+
+    for (int64_t i = opts.low; i <= opts.high; ++i) {
+      check_float_digits(float_from_rep((uint32_t)i));
+      print_num_test_progress((uint64_t)(i - opts.low), (uint64_t)opts.high);
+    }
+  } else {
+    fprintf(stderr, "Testing float digits randomly with seed %u\n", opts.seed);
+
+    uint32_t rep = opts.seed;
+    for (uint64_t i = 0; i < opts.n_tests; ++i) {
+      rep = lcg32(rep);
+
+      check_float_digits(float_from_rep(rep & ~(1U << 31U)));
+      print_num_test_progress(i, opts.n_tests);
+    }
+  }
+}
+
+int
+main(int argc, char** argv)
+{
+  const ExessNumTestOptions opts =
+    parse_num_test_options(argc, argv, 16384U, 0, UINT32_MAX);
+
+  if (!opts.error) {
+    test_shortest_digits(opts);
+    test_float_digits(opts);
+  }
+
+  return (int)opts.error;
+}
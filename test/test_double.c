@@ -1,4 +1,4 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
@@ -64,6 +64,20 @@ test_read_double(void)
   check_read("INF", EXESS_SUCCESS, (double)INFINITY, 3);
   check_read("+INF", EXESS_SUCCESS, (double)INFINITY, 4);
 
+  // Halfway between two doubles (round to even)
+  check_read("9007199254740993", EXESS_SUCCESS, 9007199254740992.0, 16);
+  check_read("9007199254740995", EXESS_SUCCESS, 9007199254740996.0, 16);
+  check_read(
+    "2.2250738585072011E-308", EXESS_SUCCESS, nextafter(DBL_MIN, 0.0), 23);
+
+  // Long significands
+  check_read("1.23456789012345678E-300",
+             EXESS_SUCCESS,
+             1.23456789012345678E-300,
+             24);
+  check_read(
+    "9.87654321098765432E300", EXESS_SUCCESS, 9.87654321098765432E300, 23);
+
   // No exponent
   check_read("1", EXESS_SUCCESS, 1.0, 1);
   check_read("2.3", EXESS_SUCCESS, 2.3, 3);
@@ -135,6 +149,9 @@ test_write_double(void)
   check_write(-0.0, EXESS_SUCCESS, 7, "-0.0E0");
   check_write(0.0, EXESS_SUCCESS, 6, "0.0E0");
   check_write(DBL_MAX, EXESS_SUCCESS, 23, "1.7976931348623157E308");
+  check_write(1e-244, EXESS_SUCCESS, 9, "1.0E-244");
+  check_write(5e-324, EXESS_SUCCESS, 9, "5.0E-324");
+  check_write(9007199254740991.0, EXESS_SUCCESS, 21, "9.007199254740991E15");
 }
 
 static void
@@ -210,6 +227,27 @@ test_round_trip(const ExessNumTestOptions opts)
   }
 }
 
+static void
+test_stats(void)
+{
+  exess_reset_stats();
+
+  double value = 0.0;
+  assert(!exess_read_double(&value, "1.5").status);
+  assert(!exess_read_double(&value, "1.2345678901234567E89").status);
+
+  // Either every read was counted exactly once, or stats are disabled
+  const ExessStats stats = exess_stats();
+  const uint64_t   total = stats.double_exact + stats.double_eisel_lemire +
+                         stats.double_soft_float + stats.double_bigint;
+
+  assert(total == 2U || total == 0U);
+  assert(stats.double_exact == total / 2U);
+
+  exess_reset_stats();
+  assert(!exess_stats().double_exact);
+}
+
 int
 main(int argc, char** argv)
 {
@@ -219,6 +257,7 @@ main(int argc, char** argv)
   if (!opts.error) {
     test_read_double();
     test_write_double();
+    test_stats();
     test_round_trip(opts);
   }
 
@@ -0,0 +1,127 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include <exess/exess.h>
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+static uint64_t
+hash_string(const ExessDatatype datatype, const char* const string)
+{
+  ExessValue value = {false};
+
+  const ExessVariableResult r =
+    exess_read_value(datatype, sizeof(value), &value, string);
+
+  assert(!r.status);
+  return exess_hash_value(datatype, r.write_count, &value);
+}
+
+static void
+check_equal(const ExessDatatype datatype,
+            const char* const   lhs_string,
+            const char* const   rhs_string)
+{
+  assert(hash_string(datatype, lhs_string) ==
+         hash_string(datatype, rhs_string));
+}
+
+static void
+check_not_equal(const ExessDatatype datatype,
+                const char* const   lhs_string,
+                const char* const   rhs_string)
+{
+  assert(hash_string(datatype, lhs_string) !=
+         hash_string(datatype, rhs_string));
+}
+
+static void
+test_hash_value(void)
+{
+  // Equal values with different representations
+  check_equal(EXESS_DOUBLE, "-0.0", "0.0");
+  check_equal(EXESS_FLOAT, "-0.0", "0.0");
+  check_equal(EXESS_DURATION, "PT86400S", "P1D");
+  check_equal(EXESS_DURATION, "P12M", "P1Y");
+  check_equal(EXESS_DURATION, "P1Y1M365D", "P2Y1M");
+  check_equal(EXESS_DURATION, "-P2Y1M365D", "-P3Y1M");
+  check_equal(
+    EXESS_DATE_TIME, "2001-02-03T04:05:06Z", "2001-02-03T05:05:06+01:00");
+  check_equal(
+    EXESS_DATE_TIME, "2001-12-31T23:00:00-05:00", "2002-01-01T04:00:00Z");
+  check_equal(EXESS_DATE_TIME, "2001-02-03T24:00:00", "2001-02-04T00:00:00");
+  check_equal(EXESS_TIME, "24:00:00", "00:00:00");
+  check_equal(EXESS_TIME, "12:00:00Z", "14:30:00+02:30");
+  check_equal(EXESS_DATE, "2001-02-03Z", "2001-02-03+00:00");
+
+  // Different values
+  check_not_equal(EXESS_BOOLEAN, "false", "true");
+  check_not_equal(EXESS_DOUBLE, "1.0", "2.0");
+  check_not_equal(EXESS_LONG, "-1", "1");
+  check_not_equal(EXESS_DURATION, "P1M", "P30D");
+  check_not_equal(EXESS_DURATION, "P1Y1M366D", "P2Y1M");
+  check_not_equal(
+    EXESS_DATE_TIME, "2001-02-03T04:05:06Z", "2001-02-03T04:05:06+01:00");
+  check_not_equal(EXESS_DATE, "2001-02-03", "2001-02-04");
+  check_not_equal(EXESS_HEX, "01", "0100");
+  check_not_equal(EXESS_BASE64, "Zm9v", "Zm9w");
+
+  // All NaNs have the same hash
+  const double dnan     = (double)NAN;
+  const double neg_dnan = -(double)NAN;
+  assert(exess_hash_value(EXESS_DOUBLE, sizeof(double), &dnan) ==
+         exess_hash_value(EXESS_DOUBLE, sizeof(double), &neg_dnan));
+
+  // Equal values of different datatypes are distinguished
+  const int64_t long_value  = 42;
+  const int64_t integer     = 42;
+  const uint8_t ubyte_value = 42U;
+  assert(exess_hash_value(EXESS_LONG, sizeof(long_value), &long_value) !=
+         exess_hash_value(EXESS_INTEGER, sizeof(integer), &integer));
+  assert(exess_hash_value(EXESS_UBYTE, 1U, &ubyte_value) !=
+         exess_hash_value(EXESS_BYTE, 1U, &ubyte_value));
+}
+
+static void
+test_hash_values(void)
+{
+  const ExessDateTime values[] = {
+    {2001, 2U, 3U, 0, 4U, 5U, 6U, 0U},
+    {2001, 2U, 3U, 4, 5U, 5U, 6U, 0U},
+    {2001, 2U, 3U, EXESS_LOCAL, 4U, 5U, 6U, 7U},
+  };
+
+  uint64_t hashes[3] = {0U, 0U, 0U};
+
+  // Errors
+  const size_t size = sizeof(values);
+  assert(exess_hash_values(EXESS_NOTHING, 3U, size, values, hashes) ==
+         EXESS_UNSUPPORTED);
+  assert(exess_hash_values(EXESS_HEX, 3U, size, values, hashes) ==
+         EXESS_UNSUPPORTED);
+  assert(exess_hash_values(EXESS_DATE_TIME, 4U, size, values, hashes) ==
+         EXESS_BAD_VALUE);
+
+  // Batch hashes are the same as single hashes
+  assert(!exess_hash_values(EXESS_DATE_TIME, 3U, size, values, hashes));
+  for (unsigned i = 0U; i < 3U; ++i) {
+    assert(hashes[i] ==
+           exess_hash_value(EXESS_DATE_TIME, sizeof(values[i]), &values[i]));
+  }
+
+  assert(hashes[0] == hashes[1]);
+  assert(hashes[0] != hashes[2]);
+}
+
+int
+main(void)
+{
+  test_hash_value();
+  test_hash_values();
+  return 0;
+}
@@ -1,4 +1,4 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
@@ -156,6 +156,202 @@ test_round_trip(void)
   }
 }
 
+// Long enough to cover several blocks of any vectorized implementation
+#define N_BYTES 100U
+#define LENGTH 200U
+
+/// Fill `data` with a test pattern and write its encoding to `str`
+static void
+make_data(uint8_t data[N_BYTES], char str[LENGTH + 2U])
+{
+  for (size_t i = 0U; i < N_BYTES; ++i) {
+    data[i] = (uint8_t)((i * 37U) + 11U);
+  }
+
+  assert(!exess_write_hex(N_BYTES, data, LENGTH + 2U, str).status);
+  assert(strlen(str) == LENGTH);
+}
+
+static void
+test_long_strings(void)
+{
+  uint8_t data[N_BYTES]    = {0U};
+  char    str[LENGTH + 2U] = {0};
+  make_data(data, str);
+
+  // Lowercase digits are read the same
+  char lower[202] = {0};
+  for (size_t i = 0U; i < LENGTH; ++i) {
+    lower[i] = (str[i] >= 'A') ? (char)(str[i] + ('a' - 'A')) : str[i];
+  }
+
+  uint8_t             decoded[100] = {0U};
+  ExessVariableResult r = exess_read_hex(sizeof(decoded), decoded, lower);
+  assert(!r.status);
+  assert(r.read_count == LENGTH);
+  assert(r.write_count == N_BYTES);
+  assert(!memcmp(decoded, data, N_BYTES));
+
+  for (size_t i = 0U; i < LENGTH; ++i) {
+    // Invalid characters are reported at the same offset as always
+    char bad[202] = {0};
+    memcpy(bad, str, LENGTH);
+    bad[i] = 'G';
+
+    memset(decoded, 0, sizeof(decoded));
+    r = exess_read_hex(sizeof(decoded), decoded, bad);
+    assert(r.status == ((i % 2U) || !i ? EXESS_EXPECTED_HEX : EXESS_SUCCESS));
+    assert(r.read_count == i);
+    assert(r.write_count == i / 2U);
+    assert(!memcmp(decoded, data, r.write_count));
+
+    // Running out of space is reported after the byte that didn't fit
+    if (i < N_BYTES) {
+      r = exess_read_hex(i, decoded, str);
+      assert(r.status == EXESS_NO_SPACE);
+      assert(r.read_count == (2U * i) + 2U);
+      assert(r.write_count == i);
+    }
+  }
+}
+
+static void
+test_null_terminated(void)
+{
+  // Shorter than the output, so vectorized decoding is limited by the input
+  static const size_t n_bytes = 20U;
+  static const size_t length  = 40U;
+
+  uint8_t data[N_BYTES]     = {0U};
+  char    full[LENGTH + 2U] = {0};
+  make_data(data, full);
+
+  // Reading stops at the terminator of an allocation shorter than the length
+  char* const str = (char*)calloc(length + 1U, 1U);
+  memcpy(str, full, length);
+
+  uint8_t                   decoded[100] = {0U};
+  const ExessVariableResult r            = exess_read_value_n(
+    EXESS_HEX, sizeof(decoded), decoded, 1000U, str);
+
+  assert(!r.status);
+  assert(r.read_count == length);
+  assert(r.write_count == n_bytes);
+  assert(!memcmp(decoded, data, n_bytes));
+
+  free(str);
+}
+
+static void
+test_in_place(void)
+{
+  uint8_t data[N_BYTES]    = {0U};
+  char    str[LENGTH + 2U] = {0};
+  make_data(data, str);
+
+  // Decode a copy with leading whitespace and a trailing delimiter over itself
+  char buf[204] = {0};
+  buf[0] = ' ';
+  memcpy(buf + 1U, str, LENGTH);
+  buf[LENGTH + 1U] = '\n';
+  buf[LENGTH + 2U] = 'X';
+
+  ExessVariableResult r = exess_read_hex_in_place(LENGTH + 2U, buf);
+  assert(!r.status);
+  assert(r.read_count == LENGTH + 1U);
+  assert(r.write_count == N_BYTES);
+  assert(!memcmp(buf, data, N_BYTES));
+  assert(buf[LENGTH + 2U] == 'X');
+
+  // Errors are reported like when decoding into a separate buffer
+  memcpy(buf, str, LENGTH);
+  buf[(LENGTH / 2U) + 1U] = '!';
+  r = exess_read_hex_in_place(LENGTH, buf);
+  assert(r.status == EXESS_EXPECTED_HEX);
+  assert(r.read_count == (LENGTH / 2U) + 1U);
+  assert(!memcmp(buf, data, r.write_count));
+
+  // Decoding stops at the terminator of an allocation shorter than the length
+  char* const copy = (char*)calloc(LENGTH + 1U, 1U);
+  memcpy(copy, str, LENGTH);
+  r = exess_read_hex_in_place(1000U, copy);
+  assert(!r.status);
+  assert(r.read_count == LENGTH);
+  assert(r.write_count == N_BYTES);
+  assert(!memcmp(copy, data, N_BYTES));
+  free(copy);
+}
+
+static void
+test_decoder(void)
+{
+  uint8_t data[N_BYTES]    = {0U};
+  char    str[LENGTH + 2U] = {0};
+  make_data(data, str);
+
+  // Break the string into lines between bytes
+  char   wrapped[240] = {0};
+  size_t wrapped_len  = 0U;
+  for (size_t i = 0U; i < LENGTH; ++i) {
+    if (i && !(i % 16U)) {
+      wrapped[wrapped_len++] = '\n';
+    }
+    wrapped[wrapped_len++] = str[i];
+  }
+
+  // Any split into two chunks decodes the same
+  uint8_t         decoded[100] = {0U};
+  ExessHexDecoder decoder;
+  for (size_t split = 0U; split <= wrapped_len; ++split) {
+    memset(decoded, 0, sizeof(decoded));
+    exess_hex_decoder_init(&decoder);
+
+    ExessVariableResult r = exess_hex_decoder_feed(
+      &decoder, split, wrapped, sizeof(decoded), decoded);
+    assert(!r.status);
+    assert(r.read_count == split);
+
+    const size_t o = r.write_count;
+    r              = exess_hex_decoder_feed(&decoder,
+                               wrapped_len - split,
+                               wrapped + split,
+                               sizeof(decoded) - o,
+                               decoded + o);
+    assert(!r.status);
+    assert(r.read_count == wrapped_len - split);
+    assert(o + r.write_count == N_BYTES);
+    assert(!exess_hex_decoder_finish(&decoder));
+    assert(!memcmp(decoded, data, N_BYTES));
+  }
+
+  // Running out of space leaves the second digit to be fed again
+  exess_hex_decoder_init(&decoder);
+  ExessVariableResult r =
+    exess_hex_decoder_feed(&decoder, 4U, "0A1B", 1U, decoded);
+  assert(r.status == EXESS_NO_SPACE);
+  assert(r.read_count == 3U);
+  assert(r.write_count == 1U);
+  assert(decoded[0] == 0x0A);
+
+  r = exess_hex_decoder_feed(&decoder, 1U, "B", 1U, decoded);
+  assert(!r.status);
+  assert(r.read_count == 1U);
+  assert(r.write_count == 1U);
+  assert(decoded[0] == 0x1B);
+
+  // Incomplete input
+  r = exess_hex_decoder_feed(&decoder, 1U, "C", 1U, decoded);
+  assert(!r.status);
+  assert(r.read_count == 1U);
+  assert(!r.write_count);
+  assert(exess_hex_decoder_finish(&decoder) == EXESS_EXPECTED_HEX);
+
+  // Whitespace within a byte is invalid
+  r = exess_hex_decoder_feed(&decoder, 2U, " D", 1U, decoded);
+  assert(r.status == EXESS_EXPECTED_HEX);
+  assert(!r.read_count);
+}
+
 int
 main(void)
 {
@@ -165,6 +361,10 @@ main(void)
   test_read_overflow();
   test_write_overflow();
   test_round_trip();
+  test_long_strings();
+  test_null_terminated();
+  test_in_place();
+  test_decoder();
 
   return 0;
 }
@@ -1,4 +1,4 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
@@ -104,6 +104,9 @@ test_write_long(void)
   check_write(-1, EXESS_SUCCESS, 3, "-1");
   check_write(0, EXESS_SUCCESS, 2, "0");
   check_write(1, EXESS_SUCCESS, 2, "1");
+  check_write(-10, EXESS_SUCCESS, 4, "-10");
+  check_write(-305, EXESS_SUCCESS, 5, "-305");
+  check_write(4096, EXESS_SUCCESS, 5, "4096");
   check_write(INT64_MIN, EXESS_SUCCESS, 21, "-9223372036854775808");
   check_write(INT64_MAX, EXESS_SUCCESS, 20, "9223372036854775807");
 
@@ -0,0 +1,222 @@
+// Copyright 2026 David Robillard <d@drobilla.net>
+// SPDX-License-Identifier: ISC
+
+#undef NDEBUG
+
+#include "int_test_utils.h"
+
+#include <exess/exess.h>
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Enough values for several chunks (which are 16 KiB of values)
+#define N_VALUES 40000U
+
+static char*
+grow_heap(void* const   handle,
+          const size_t  min_size,
+          size_t* const heap_size,
+          char* const   heap)
+{
+  size_t* const n_calls = (size_t*)handle;
+  const size_t  size    = (*heap_size * 2U > min_size) ? (*heap_size * 2U)
+                                                       : min_size;
+
+  char* const new_heap = (char*)realloc(heap, size);
+  if (new_heap) {
+    *heap_size = size;
+    ++*n_calls;
+  }
+
+  return new_heap;
+}
+
+static void
+test_long_values(const unsigned n_threads)
+{
+  int64_t* const values  = (int64_t*)calloc(N_VALUES, sizeof(int64_t));
+  size_t* const  offsets = (size_t*)calloc(N_VALUES + 1U, sizeof(size_t));
+  size_t* const  serial_offsets =
+    (size_t*)calloc(N_VALUES + 1U, sizeof(size_t));
+
+  uint64_t rng = 1U;
+  for (size_t i = 0U; i < N_VALUES; ++i) {
+    rng       = lcg64(rng);
+    values[i] = (int64_t)(rng >> (rng % 64U));
+  }
+
+  // Write serially to get the expected output
+  size_t serial_size    = 0U;
+  char*  serial_heap    = NULL;
+  size_t n_serial_calls = 0U;
+  assert(!exess_write_values(EXESS_LONG,
+                             N_VALUES,
+                             N_VALUES * sizeof(int64_t),
+                             values,
+                             serial_offsets,
+                             &serial_size,
+                             &serial_heap,
+                             grow_heap,
+                             &n_serial_calls));
+
+  // Write in parallel
+  size_t heap_size    = 0U;
+  char*  heap         = NULL;
+  size_t n_grow_calls = 0U;
+  assert(!exess_parallel_write_values(n_threads,
+                                      EXESS_LONG,
+                                      N_VALUES,
+                                      N_VALUES * sizeof(int64_t),
+                                      values,
+                                      offsets,
+                                      &heap_size,
+                                      &heap,
+                                      grow_heap,
+                                      &n_grow_calls));
+
+  assert(n_grow_calls);
+  assert(!memcmp(offsets, serial_offsets, (N_VALUES + 1U) * sizeof(size_t)));
+  assert(!memcmp(heap, serial_heap, offsets[N_VALUES] + 1U));
+
+  // Read everything back in parallel
+  ExessStringView* const strings =
+    (ExessStringView*)calloc(N_VALUES, sizeof(ExessStringView));
+  for (size_t i = 0U; i < N_VALUES; ++i) {
+    strings[i].data   = heap + offsets[i];
+    strings[i].length = offsets[i + 1U] - offsets[i];
+  }
+
+  int64_t* const read_values = (int64_t*)calloc(N_VALUES, sizeof(int64_t));
+  assert(!exess_parallel_read_values(n_threads,
+                                     EXESS_LONG,
+                                     N_VALUES,
+                                     strings,
+                                     N_VALUES * sizeof(int64_t),
+                                     read_values,
+                                     NULL));
+
+  assert(!memcmp(read_values, values, N_VALUES * sizeof(int64_t)));
+
+  // Insufficient space is checked before doing anything
+  assert(exess_parallel_read_values(n_threads,
+                                    EXESS_LONG,
+                                    N_VALUES,
+                                    strings,
+                                    (N_VALUES - 1U) * sizeof(int64_t),
+                                    read_values,
+                                    NULL) == EXESS_NO_SPACE);
+
+  free(read_values);
+  free(strings);
+  free(heap);
+  free(serial_heap);
+  free(serial_offsets);
+  free(offsets);
+  free(values);
+}
+
+static void
+test_errors(const unsigned n_threads)
+{
+  ExessDate* const dates   = (ExessDate*)calloc(N_VALUES, sizeof(ExessDate));
+  size_t* const    offsets = (size_t*)calloc(N_VALUES + 1U, sizeof(size_t));
+
+  for (size_t i = 0U; i < N_VALUES; ++i) {
+    dates[i].year  = (int16_t)(i % 3000U);
+    dates[i].month = (uint8_t)(1U + (i % 12U));
+    dates[i].day   = (uint8_t)(1U + (i % 28U));
+    dates[i].zone  = EXESS_LOCAL;
+  }
+
+  // Invalidate a late value, then an early one
+  dates[N_VALUES - 2U].month = 13U;
+  dates[N_VALUES / 2U].day   = 0U;
+
+  // The heap can't grow without a grow function
+  size_t heap_size = 0U;
+  char*  heap      = NULL;
+  assert(exess_parallel_write_values(n_threads,
+                                     EXESS_DATE,
+                                     N_VALUES,
+                                     N_VALUES * sizeof(ExessDate),
+                                     dates,
+                                     offsets,
+                                     &heap_size,
+                                     &heap,
+                                     NULL,
+                                     NULL) == EXESS_NO_SPACE);
+
+  // Invalid values are written as empty strings
+  size_t n_grow_calls = 0U;
+  assert(exess_parallel_write_values(n_threads,
+                                     EXESS_DATE,
+                                     N_VALUES,
+                                     N_VALUES * sizeof(ExessDate),
+                                     dates,
+                                     offsets,
+                                     &heap_size,
+                                     &heap,
+                                     grow_heap,
+                                     &n_grow_calls) == EXESS_BAD_VALUE);
+
+  assert(offsets[N_VALUES / 2U] == offsets[(N_VALUES / 2U) + 1U]);
+  assert(offsets[N_VALUES - 2U] == offsets[N_VALUES - 1U]);
+
+  // Read everything back, with an invalid string
+  ExessStringView* const strings =
+    (ExessStringView*)calloc(N_VALUES, sizeof(ExessStringView));
+  for (size_t i = 0U; i < N_VALUES; ++i) {
+    strings[i].data   = heap + offsets[i];
+    strings[i].length = offsets[i + 1U] - offsets[i];
+  }
+
+  strings[N_VALUES / 4U].data   = "2001-02-30";
+  strings[N_VALUES / 4U].length = 10U;
+
+  ExessDate* const read_dates = (ExessDate*)calloc(N_VALUES, sizeof(ExessDate));
+  ExessStatus* const statuses =
+    (ExessStatus*)calloc(N_VALUES, sizeof(ExessStatus));
+
+  assert(exess_parallel_read_values(n_threads,
+                                    EXESS_DATE,
+                                    N_VALUES,
+                                    strings,
+                                    N_VALUES * sizeof(ExessDate),
+                                    read_dates,
+                                    statuses) == EXESS_OUT_OF_RANGE);
+
+  // The first error is returned, and all values are still read
+  for (size_t i = 0U; i < N_VALUES; ++i) {
+    if (i == N_VALUES / 4U) {
+      assert(statuses[i] == EXESS_OUT_OF_RANGE);
+    } else if (i == N_VALUES / 2U || i == N_VALUES - 2U) {
+      assert(statuses[i] == EXESS_EXPECTED_DIGIT);
+    } else {
+      assert(!statuses[i]);
+      assert(!memcmp(&read_dates[i], &dates[i], sizeof(ExessDate)));
+    }
+  }
+
+  free(statuses);
+  free(read_dates);
+  free(strings);
+  free(heap);
+  free(offsets);
+  free(dates);
+}
+
+int
+main(void)
+{
+  static const unsigned thread_counts[] = {0U, 1U, 2U, 3U, 8U};
+
+  for (size_t i = 0U; i < sizeof(thread_counts) / sizeof(unsigned); ++i) {
+    test_long_values(thread_counts[i]);
+    test_errors(thread_counts[i]);
+  }
+
+  return 0;
+}
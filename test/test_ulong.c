@@ -1,4 +1,4 @@
-// Copyright 2011-2025 David Robillard <d@drobilla.net>
+// Copyright 2011-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
@@ -50,8 +50,29 @@ test_read_ulong(void)
   check_read(
     "18446744073709551615", EXESS_SUCCESS, UINT64_MAX, EXESS_MAX_ULONG_LENGTH);
 
+  // Every number of digits (to hit every combination of 8 and 1 at a time)
+  check_read("1", EXESS_SUCCESS, 1U, 1);
+  check_read("12", EXESS_SUCCESS, 12U, 2);
+  check_read("123", EXESS_SUCCESS, 123U, 3);
+  check_read("1234567", EXESS_SUCCESS, 1234567U, 7);
+  check_read("12345678", EXESS_SUCCESS, 12345678U, 8);
+  check_read("123456789", EXESS_SUCCESS, 123456789U, 9);
+  check_read("9876543210987654", EXESS_SUCCESS, 9876543210987654U, 16);
+  check_read("98765432109876543", EXESS_SUCCESS, 98765432109876543U, 17);
+  check_read("9999999999999999999", EXESS_SUCCESS, 9999999999999999999U, 19);
+  check_read("10000000000000000000", EXESS_SUCCESS, 10000000000000000000U, 20);
+  check_read("000000000000000000000000000000000000000012345678901234567890",
+             EXESS_SUCCESS,
+             12345678901234567890U,
+             60);
+
   // Out of range
   check_read("18446744073709551616", EXESS_OUT_OF_RANGE, 0, 19);
+  check_read("18446744073709551620", EXESS_OUT_OF_RANGE, 0, 19);
+  check_read("30000000000000000000", EXESS_OUT_OF_RANGE, 0, 19);
+  check_read("99999999999999999999", EXESS_OUT_OF_RANGE, 0, 19);
+  check_read("100000000000000000000", EXESS_OUT_OF_RANGE, 0, 20);
+  check_read("+0184467440737095516150", EXESS_OUT_OF_RANGE, 0, 22);
 
   // Trailing garbage
   check_read("1234extra", EXESS_SUCCESS, 1234, 4);
@@ -93,6 +114,12 @@ test_write_ulong(void)
   check_write(0U, EXESS_SUCCESS, 2, "0");
   check_write(1U, EXESS_SUCCESS, 2, "1");
   check_write(UINT64_MAX, EXESS_SUCCESS, 21, "18446744073709551615");
+  check_write(10U, EXESS_SUCCESS, 3, "10");
+  check_write(99U, EXESS_SUCCESS, 3, "99");
+  check_write(100U, EXESS_SUCCESS, 4, "100");
+  check_write(1203U, EXESS_SUCCESS, 5, "1203");
+  check_write(90807U, EXESS_SUCCESS, 6, "90807");
+  check_write(10000000000000000000U, EXESS_SUCCESS, 21, "10000000000000000000");
 
   check_write(1234U, EXESS_NO_SPACE, 4, "");
 
@@ -1,4 +1,4 @@
-// Copyright 2021-2025 David Robillard <d@drobilla.net>
+// Copyright 2021-2026 David Robillard <d@drobilla.net>
 // SPDX-License-Identifier: ISC
 
 #undef NDEBUG
@@ -13,6 +13,7 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const ExessDuration duration = {14,
@@ -187,6 +188,267 @@ test_read_value(void)
   }
 }
 
+static void
+check_read_n(const ExessDatatype datatype, const char* const string)
+{
+  const size_t length = strlen(string);
+
+  for (size_t n = 0U; n <= length; ++n) {
+    // Copy prefix into an exactly sized buffer with no terminator
+    char* const unterminated = (char*)malloc(n + 1U);
+    memcpy(unterminated, string, n);
+
+    // Copy prefix into a null-terminated string to compare with
+    char* const terminated = (char*)calloc(n + 1U, 1U);
+    memcpy(terminated, string, n);
+
+    ExessValue                bounded_value;
+    ExessValue                terminated_value;
+    const ExessVariableResult bounded = exess_read_value_n(
+      datatype, sizeof(bounded_value), &bounded_value, n, unterminated);
+    const ExessVariableResult expected = exess_read_value(
+      datatype, sizeof(terminated_value), &terminated_value, terminated);
+
+    assert(bounded.status == expected.status);
+    assert(bounded.read_count == expected.read_count);
+    assert(bounded.write_count == expected.write_count);
+    assert(bounded.read_count <= n);
+    assert(!memcmp(&bounded_value, &terminated_value, expected.write_count));
+
+    free(terminated);
+    free(unterminated);
+  }
+}
+
+static void
+test_read_value_n(void)
+{
+  typedef struct {
+    ExessDatatype datatype;
+    const char*   string;
+  } Case;
+
+  static const Case cases[] = {
+    {EXESS_BOOLEAN, " true"},
+    {EXESS_BOOLEAN, "false"},
+    {EXESS_DECIMAL, " -012.3450"},
+    {EXESS_DOUBLE, "-1.2345E-67"},
+    {EXESS_DOUBLE, "-INF"},
+    {EXESS_DOUBLE, "NaN"},
+    {EXESS_FLOAT, "+1.5e+3"},
+    {EXESS_INTEGER, "-9223372036854775808"},
+    {EXESS_NON_POSITIVE_INTEGER, "-00120"},
+    {EXESS_NEGATIVE_INTEGER, "-1"},
+    {EXESS_LONG, "\t123456789012345678"},
+    {EXESS_INT, "-2147483648"},
+    {EXESS_SHORT, "32767"},
+    {EXESS_BYTE, "-128"},
+    {EXESS_NON_NEGATIVE_INTEGER, "-0"},
+    {EXESS_ULONG, "18446744073709551615"},
+    {EXESS_UINT, "+4294967295"},
+    {EXESS_USHORT, "65535"},
+    {EXESS_UBYTE, "255"},
+    {EXESS_POSITIVE_INTEGER, "1"},
+    {EXESS_DURATION, "-P1Y2M3DT4H5M6.789S"},
+    {EXESS_DATE_TIME, "2001-02-03T04:05:06.789-05:30"},
+    {EXESS_TIME, "24:00:00Z"},
+    {EXESS_DATE, "-12345-01-02+14:00"},
+    {EXESS_HEX, " DEADBEEF"},
+    {EXESS_BASE64, "Zm9v YmFy"},
+  };
+
+  for (size_t i = 0U; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+    check_read_n(cases[i].datatype, cases[i].string);
+  }
+
+  // Reading stops at the given length even if the string continues
+  int64_t                   a_long = 0;
+  const ExessVariableResult r =
+    exess_read_value_n(EXESS_LONG, sizeof(a_long), &a_long, 3U, "12345");
+
+  assert(!r.status);
+  assert(r.read_count == 3U);
+  assert(a_long == 123);
+}
+
+static void
+test_read_values(void)
+{
+  static const ExessStringView strings[] = {
+    {"12", 2U},
+    {" -34 ", 5U},
+    {"5x", 2U},
+    {"9223372036854775808", 19U},
+    {"67", 1U},
+  };
+
+  static const size_t n_strings = sizeof(strings) / sizeof(strings[0]);
+
+  int64_t     longs[5]    = {0, 0, 0, 0, 0};
+  ExessStatus statuses[5] = {
+    EXESS_SUCCESS, EXESS_SUCCESS, EXESS_SUCCESS, EXESS_SUCCESS, EXESS_SUCCESS};
+
+  // Unsupported datatype or insufficient space
+  assert(exess_read_values(EXESS_HEX, 1U, strings, 8U, longs, statuses) ==
+         EXESS_UNSUPPORTED);
+  assert(exess_read_values(EXESS_LONG, 2U, strings, 15U, longs, statuses) ==
+         EXESS_NO_SPACE);
+
+  // Every value is read, and the first error is returned
+  assert(exess_read_values(EXESS_LONG,
+                           n_strings,
+                           strings,
+                           sizeof(longs),
+                           longs,
+                           statuses) == EXESS_BAD_VALUE);
+
+  assert(!statuses[0] && longs[0] == 12);
+  assert(!statuses[1] && longs[1] == -34);
+  assert(statuses[2] == EXESS_BAD_VALUE);
+  assert(statuses[3] == EXESS_OUT_OF_RANGE);
+  assert(!statuses[4] && longs[4] == 6);
+
+  // Statuses are optional, and subtypes are checked
+  static const ExessStringView ulong_strings[] = {{"12", 2U}, {"0", 1U}};
+
+  uint64_t ulongs[2] = {0U, 0U};
+  assert(!exess_read_values(
+    EXESS_ULONG, 2U, ulong_strings, sizeof(ulongs), ulongs, NULL));
+  assert(ulongs[0] == 12U);
+  assert(ulongs[1] == 0U);
+  assert(exess_read_values(EXESS_POSITIVE_INTEGER,
+                           2U,
+                           ulong_strings,
+                           sizeof(ulongs),
+                           ulongs,
+                           statuses) == EXESS_OUT_OF_RANGE);
+  assert(!statuses[0]);
+  assert(statuses[1] == EXESS_OUT_OF_RANGE);
+
+  // Larger values are written contiguously
+  static const ExessStringView date_strings[] = {
+    {"2001-02-03", 10U},
+    {"2004-05-06Z", 11U},
+  };
+
+  ExessDate dates[2];
+  assert(!exess_read_values(
+    EXESS_DATE, 2U, date_strings, sizeof(dates), dates, statuses));
+  assert(dates[0].year == 2001 && dates[0].zone == EXESS_LOCAL);
+  assert(dates[1].day == 6 && dates[1].zone == EXESS_UTC);
+}
+
+static char*
+grow_heap(void* const   handle,
+          const size_t  min_size,
+          size_t* const heap_size,
+          char* const   heap)
+{
+  size_t* const n_calls = (size_t*)handle;
+  const size_t  size    = (*heap_size * 2U > min_size) ? (*heap_size * 2U)
+                                                       : min_size;
+
+  char* const new_heap = (char*)realloc(heap, size);
+  if (new_heap) {
+    *heap_size = size;
+    ++*n_calls;
+  }
+
+  return new_heap;
+}
+
+static void
+test_write_values(void)
+{
+  static const int64_t longs[] = {0, -1, 42, INT64_MIN, INT64_MAX};
+
+  size_t offsets[6]   = {0U, 0U, 0U, 0U, 0U, 0U};
+  size_t heap_size    = 0U;
+  char*  heap         = NULL;
+  size_t n_grow_calls = 0U;
+
+  // Unsupported datatype or insufficient input
+  assert(exess_write_values(EXESS_HEX,
+                            1U,
+                            sizeof(longs),
+                            longs,
+                            offsets,
+                            &heap_size,
+                            &heap,
+                            grow_heap,
+                            &n_grow_calls) == EXESS_UNSUPPORTED);
+  assert(exess_write_values(EXESS_LONG,
+                            6U,
+                            sizeof(longs),
+                            longs,
+                            offsets,
+                            &heap_size,
+                            &heap,
+                            grow_heap,
+                            &n_grow_calls) == EXESS_BAD_VALUE);
+
+  // No space and no way to grow
+  assert(exess_write_values(EXESS_LONG,
+                            5U,
+                            sizeof(longs),
+                            longs,
+                            offsets,
+                            &heap_size,
+                            &heap,
+                            NULL,
+                            NULL) == EXESS_NO_SPACE);
+  assert(!heap);
+
+  // Growing from an empty heap
+  assert(!exess_write_values(EXESS_LONG,
+                             5U,
+                             sizeof(longs),
+                             longs,
+                             offsets,
+                             &heap_size,
+                             &heap,
+                             grow_heap,
+                             &n_grow_calls));
+
+  static const char* const expected =
+    "0-142-92233720368547758089223372036854775807";
+
+  assert(heap);
+  assert(n_grow_calls == 5U);
+  assert(offsets[0] == 0U);
+  assert(offsets[1] == 1U);
+  assert(offsets[2] == 3U);
+  assert(offsets[3] == 5U);
+  assert(offsets[4] == 25U);
+  assert(offsets[5] == strlen(expected));
+  assert(!strncmp(heap, expected, offsets[5]));
+
+  // Invalid values are skipped, and the existing heap is reused
+  static const ExessDate dates[] = {{2001, 2, 3, EXESS_LOCAL},
+                                    {2001, 13, 1, EXESS_LOCAL},
+                                    {2004, 5, 6, EXESS_UTC}};
+
+  n_grow_calls = 0U;
+  assert(exess_write_values(EXESS_DATE,
+                            3U,
+                            sizeof(dates),
+                            dates,
+                            offsets,
+                            &heap_size,
+                            &heap,
+                            grow_heap,
+                            &n_grow_calls) == EXESS_BAD_VALUE);
+
+  assert(!n_grow_calls);
+  assert(offsets[0] == 0U);
+  assert(offsets[1] == 10U);
+  assert(offsets[2] == 10U);
+  assert(offsets[3] == 21U);
+  assert(!strncmp(heap, "2001-02-032004-05-06Z", offsets[3]));
+
+  free(heap);
+}
+
 static void
 check_write(const ExessDatatype datatype,
             const size_t        value_size,
@@ -284,7 +546,10 @@ int
 main(void)
 {
   test_read_value();
+  test_read_value_n();
+  test_read_values();
   test_write_value();
+  test_write_values();
 
   return 0;
 }